@@ -1,12 +1,25 @@
 #pragma once
 
+#include <array>
 #include <vector>
 #include <cassert>
 #include "config.h"
+#include "Matrix16x16.h"
 
 class MockBackend
 {
 public:
+    // the shift register chain: SR_CHAIN_CHIPS 8-bit registers, one output per bit
+    using Word = Matrix16x16::Word;
+    static constexpr int kChainBits = SR_CHAIN_CHIPS * 8;
+
+    // one rising edge on the latch pin
+    struct LatchEvent
+    {
+        uint64_t timeNs;
+        Word     word;
+    };
+
     MockBackend()
     {
         gpio.backend = this;
@@ -26,11 +39,14 @@ public:
                 // rising edge: cache bits
                 if (!backend->latchLevel && level)
                 {
-                    backend->latchedWord = backend->shiftedBits;
+                    backend->integrateLuminance();
+                    backend->latchedWord  = backend->shiftedBits;
+                    backend->outputsValid = true;
+                    backend->latchLog.push_back({backend->nowNs, backend->latchedWord});
                 }
                 
                 // falling edge: restart bit count
-                if (backend->latchedWord && !level)
+                if (bitops::any(backend->latchedWord) && !level)
                 {
                     backend->bitCount = 0;
                 }
@@ -38,6 +54,11 @@ public:
                 backend->latchLevel = level;
             }
 
+            if (pin == backend->oePin)
+            {
+                backend->integrateLuminance();
+                backend->oeLevel = level;
+            }
         }
 
         MockBackend* backend = nullptr;
@@ -46,21 +67,37 @@ public:
     struct
     {
         void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1)  {}
-        void beginTransaction(SPISettings settings)                                      {}
         void endTransaction()                                                            {}
 
+        void beginTransaction(SPISettings settings)
+        {
+            backend->spiClockHz = settings.clock;
+        }
+
         void writeBytes(const uint8_t *data, uint32_t size)
         {
             for (int32_t byte = 0; byte<size; byte++)
             {
                 for (uint32_t bit = 0; bit < 8; bit++)
                 {
-                    backend->shiftedBits  = backend->shiftedBits << 1;
-                    backend->shiftedBits |= (data[byte] & (1 << bit)) ? 0x1 : 0x0;
+                    backend->shiftedBits = static_cast<Word>(backend->shiftedBits << 1);
+                    if (data[byte] & (1 << bit))
+                    {
+                        backend->shiftedBits |= bitops::bit<Word>(0);
+                    }
                     
                     ++backend->bitCount;
                 }
             }
+
+            // bits shifted past the last register fall off the chain
+            backend->shiftedBits &= bitops::lowMask<Word>(kChainBits);
+
+            // the bus is busy for 8 clock cycles per byte
+            if (backend->spiClockHz > 0)
+            {
+                backend->advanceNs((static_cast<uint64_t>(size) * 8u * 1000000000ull) / backend->spiClockHz);
+            }
         }
 
         MockBackend* backend = nullptr;
@@ -68,17 +105,76 @@ public:
 
     uint64_t micros()
     {
-        return 0;
+        return nowNs / 1000u;
     }
 
-    void delayMicroseconds(uint32_t /*us*/) {}
+    void delayMicroseconds(uint32_t us)
+    {
+        advanceNs(static_cast<uint64_t>(us) * 1000u);
+    }
 
     void reset()
     {
-        latchLevel  = false;
-        shiftedBits = 0;
-        bitCount    = 0;
-        latchedWord = 0;
+        latchLevel   = false;
+        shiftedBits  = Word{};
+        bitCount     = 0;
+        latchedWord  = Word{};
+        outputsValid = false;
+        resetTiming();
+    }
+
+    // restart the virtual clock and the luminance integration, keeping the latched outputs
+    void resetTiming()
+    {
+        nowNs        = 0;
+        integratedNs = 0;
+        latchLog.clear();
+        for (auto& row : ledOnNs)
+        {
+            row.fill(0);
+        }
+    }
+
+    void advanceNs(uint64_t ns)
+    {
+        nowNs += ns;
+        integrateLuminance();
+    }
+
+    bool isLedOn(int x, int y) const
+    {
+        if (!outputsValid || oeLevel || x < 0 || x >= LED_MATRIX_COLS || y < 0 || y >= LED_MATRIX_ROWS)
+            return false;
+
+        // undo the LSB-first wire order and the active-low wiring
+        const Word word = static_cast<Word>(~reverseBits(latchedWord));
+        return bitops::test(word, LED_MATRIX_COLS + LED_MATRIX_ROWS - y - 1)
+            && bitops::test(word, LED_MATRIX_COLS - x - 1);
+    }
+
+    uint64_t ledOnTimeNs(int x, int y) const
+    {
+        return ledOnNs[y][x];
+    }
+
+    // fraction of the elapsed virtual time the LED was lit
+    float luminance(int x, int y) const
+    {
+        return nowNs == 0 ? 0.0f : static_cast<float>(ledOnNs[y][x]) / static_cast<float>(nowNs);
+    }
+
+    // mirror the chain: the first bit shifted in ends up in the last register
+    static Word reverseBits(const Word& v)
+    {
+        Word result{};
+        for (int bit = 0; bit < kChainBits; ++bit)
+        {
+            if (bitops::test(v, bit))
+            {
+                result |= bitops::bit<Word>(kChainBits - 1 - bit);
+            }
+        }
+        return result;
     }
 
     int      dataPin     = PIN_SR_DATA;
@@ -86,7 +182,39 @@ public:
     int      latchPin    = PIN_SR_LATCH;
     int      oePin       = PIN_SR_OE;
     bool     latchLevel  = false;
-    uint32_t shiftedBits = 0;
+    bool     oeLevel     = false;
+    Word     shiftedBits = Word{};
     int      bitCount    = 0;
-    uint32_t latchedWord = 0;
+    Word     latchedWord = Word{};
+
+    // virtual time
+    uint32_t                spiClockHz   = 0;
+    uint64_t                nowNs        = 0;
+    bool                    outputsValid = false;
+    std::vector<LatchEvent> latchLog;
+
+private:
+    // credit the time since the last call to every LED the current outputs light up
+    void integrateLuminance()
+    {
+        const uint64_t elapsedNs = nowNs - integratedNs;
+        integratedNs = nowNs;
+
+        if (elapsedNs == 0)
+            return;
+
+        for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+        {
+            for (int x = 0; x < LED_MATRIX_COLS; ++x)
+            {
+                if (isLedOn(x, y))
+                {
+                    ledOnNs[y][x] += elapsedNs;
+                }
+            }
+        }
+    }
+
+    uint64_t                                                           integratedNs = 0;
+    std::array<std::array<uint64_t, LED_MATRIX_COLS>, LED_MATRIX_ROWS> ledOnNs{};
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stddef.h>
 
 // hardware related stuff
 constexpr int      PIN_SR_DATA  = 40;
@@ -10,20 +11,62 @@ constexpr int      PIN_SR_OE    = 21;
 
 constexpr uint32_t SHIFTREG_SPI_FREQUENCY_HZ = 4'000'000;
 
+// Shortest scan phase the timer ISR can honour: latching a word shifts
+// SR_CHAIN_CHIPS * 8 bits at the SPI clock (8 us for 4 chips at 4 MHz), plus a
+// margin for ISR entry and exit. BCM planes are never planned shorter.
+constexpr uint32_t SCAN_ISR_MARGIN_US = 4;
+constexpr uint32_t SCAN_MIN_PHASE_US  = (SR_CHAIN_CHIPS * 8u * 1'000'000u + SHIFTREG_SPI_FREQUENCY_HZ - 1u) / SHIFTREG_SPI_FREQUENCY_HZ
+                                      + SCAN_ISR_MARGIN_US;
+
+// Row load compensation: shorten the on-time of sparsely lit rows so they match
+// the brightness of fully lit rows (gain x/256 for a row with one lit LED,
+// rising linearly to 256 for a full row)
+constexpr bool     ROW_LOAD_COMPENSATION_ENABLED = false;
+constexpr uint16_t ROW_LOAD_SPARSE_GAIN          = 192;
+
+// Upper bound for the time a single row may be lit, in percent of the nominal
+// frame period (only reachable when blank rows are skipped)
+constexpr uint32_t SCAN_MAX_ROW_DUTY_PERCENT = 25;
+
+// Scan-out timing statistics recorded by the scan ISR (GET /api/stats/scan);
+// override with -DSCAN_STATS_ENABLED=0 to compile the instrumentation out
+#ifndef SCAN_STATS_ENABLED
+    #define SCAN_STATS_ENABLED 1
+#endif
+
 // Animated text defaults
 constexpr const char* DEFAULT_INITIAL_TEXT                  = "Hello World  ";
 constexpr bool        DEFAULT_TEXT_LOOPING                  = true;
 constexpr bool        DEFAULT_TEXT_ANIMATION_MODE           = 1; // 0: Hold, 1: Scroll
 constexpr uint32_t    DEFAULT_TEXT_FRAME_DURATION_LOOP_MS   = 50;
 constexpr uint32_t    DEFAULT_TEXT_FRAME_DURATION_HOLD_MS   = 500;
+constexpr size_t      TEXT_TICKER_CAPACITY                  = 256; // characters buffered per ticker line
 
 // Animated image defaults
 constexpr uint32_t    DEFAULT_IMAGE_FRAME_DURATION_MS  = 200;
 constexpr bool        DEFAULT_IMAGE_LOOPING            = true;
+constexpr size_t      FRAME_STORE_KEYFRAME_INTERVAL    = 16; // stored frames per keyframe (the rest are deltas)
+constexpr size_t      IMAGE_STREAM_MAX_FRAMES          = 4096; // longest binary upload to /api/images/stream
+
+// Live frames (WebSocket, DisplayMode::Live)
+constexpr uint16_t    LIVE_WEBSOCKET_PORT              = 81;
+constexpr size_t      LIVE_FRAME_BUFFER_CAPACITY       = 8;  // queued frames; newer ones are dropped when full
+constexpr size_t      LIVE_JITTER_TARGET_FRAMES        = 1;  // frames left queued behind the shown one; older ones are skipped
+constexpr uint32_t    LIVE_JITTER_DELAY_MS             = 6;  // playout delay of the first frame after a gap
+constexpr uint32_t    LIVE_DEFAULT_FRAME_INTERVAL_MS   = 16; // playout step until the arrival rate is measured
+
+// Live frames over UDP (DisplayMode::Live, see UdpFrameReceiver)
+constexpr uint16_t    LIVE_UDP_PORT                    = 7777;
+constexpr size_t      LIVE_UDP_MAX_FRAMES_PER_PACKET   = 16;   // 12 + 16 * 32 bytes stays below one Ethernet MTU
+constexpr uint32_t    LIVE_UDP_STREAM_TIMEOUT_MS       = 1000; // silence after which sequence numbers may start over
 
 
 constexpr const char* WIFI_HOSTNAME = "led_panel";
 
+// Longest the web task sleeps between HTTP polls while no animation is due
+constexpr uint32_t    WEB_POLL_INTERVAL_MS = 10;
+constexpr uint32_t    LIVE_POLL_INTERVAL_MS = 2; // same while showing live frames
+
 // Arduino dependencies 
 #ifdef ARDUINO
     #include <Arduino.h>
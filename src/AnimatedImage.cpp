@@ -1,25 +1,58 @@
 #include "AnimatedImage.h"
 
+#include <algorithm>
+#include <utility>
+
 void AnimatedImage::setFrames(const std::vector<Image>& newFrames)
 {
-    frames = newFrames;
+    std::shared_ptr<FrameStore> store = std::make_shared<FrameStore>();
+    for (const Image& frame : newFrames)
+    {
+        store->append(frame);
+    }
+    store->shrinkToFit();
+    setFrames(FrameSequence(std::move(store)));
+}
+
+void AnimatedImage::setFrames(FrameSequence newFrames)
+{
+    frames = std::move(newFrames);
+    cursor = FrameStore::Cursor{};
+    stagedFrames.reset();
+    swapPending = false;
     reset();
 }
 
+void AnimatedImage::stageFrames(FrameSequence newFrames, bool keepPhase)
+{
+    stagedFrames    = std::move(newFrames);
+    swapPending     = true;
+    stagedKeepPhase = keepPhase;
+}
+
+bool AnimatedImage::hasStagedFrames() const
+{
+    return swapPending;
+}
+
 void AnimatedImage::clearFrames()
 {
-    frames.clear();
-    reset();
+    setFrames(FrameSequence());
+}
+
+const FrameSequence& AnimatedImage::getFrames() const
+{
+    return frames;
 }
 
 void AnimatedImage::setFrameDuration(uint32_t milliseconds)
 {
-    frameDurationMs = milliseconds;
+    timeline.setStepDuration(milliseconds);
 }
 
 uint32_t AnimatedImage::getFrameDuration() const
 {
-    return frameDurationMs;
+    return timeline.getStepDuration();
 }
 
 void AnimatedImage::setLooping(bool enable)
@@ -35,52 +68,87 @@ bool AnimatedImage::isLooping() const
 void AnimatedImage::reset()
 {
     currentIndex = 0;
-    lastFrameTimestamp = 0;
     hasDisplayedFrame = false;
-    matrix.clear();
+    seekPending = false;
+    timeline.stop();
+    clearFrame();
+}
+
+void AnimatedImage::seek(uint32_t positionMs)
+{
+    seekPending    = true;
+    seekPositionMs = positionMs;
 }
 
 Matrix16x16 AnimatedImage::update(uint32_t nowMs)
 {
-    if (frames.empty())
+    advance(nowMs);
+    return matrix;
+}
+
+bool AnimatedImage::render(Matrix16x16& target, uint32_t nowMs)
+{
+    advance(nowMs);
+    if (!frameChanged)
+        return false;
+
+    target.copyFrom(matrix);
+    frameChanged = false;
+    return true;
+}
+
+void AnimatedImage::advance(uint32_t nowMs)
+{
+    uint32_t overshootMs = 0;
+    if (swapPending && swapDue(nowMs, overshootMs))
+    {
+        swapStaged(nowMs, overshootMs);
+    }
+
+    if (store().empty())
     {
         if (hasDisplayedFrame)
         {
-            matrix.clear();
+            clearFrame();
             hasDisplayedFrame = false;
         }
-        return matrix;
+        return;
     }
 
-    if (!hasDisplayedFrame)
+    if (!hasDisplayedFrame || seekPending)
     {
-        showFrame(currentIndex);
-        hasDisplayedFrame = true;
-        lastFrameTimestamp = nowMs;
-        return matrix;
+        startAt(nowMs, seekPending ? seekPositionMs : 0);
+        seekPending = false;
+        return;
     }
 
-    if (frameDurationMs > 0 && (nowMs - lastFrameTimestamp) < frameDurationMs)
-        return matrix;
+    if (store().hasDurations())
+    {
+        showFrameAt(nowMs);
+        return;
+    }
 
-    lastFrameTimestamp = nowMs;
+    const uint32_t steps = timeline.advance(nowMs);
+    if (steps == 0)
+        return;
 
-    size_t next = currentIndex + 1;
-    if (next >= frames.size())
+    // skip the frames whose time already passed during a stall
+    size_t next = 0;
+    if (looping)
     {
-        if (!looping)
-        {
-            hasDisplayedFrame = true;
-            return matrix;
-        }
-        next = 0;
+        next = (currentIndex + steps % store().size()) % store().size();
+    }
+    else
+    {
+        const size_t remaining = store().size() - 1 - currentIndex;
+        next = (steps >= remaining) ? store().size() - 1 : currentIndex + steps;
     }
 
-    currentIndex = next;
-    showFrame(currentIndex);
-    hasDisplayedFrame = true;
-
-    return matrix;
+    if (next != currentIndex)
+    {
+        currentIndex = next;
+        showFrame(currentIndex);
+    }
 }
 
 bool AnimatedImage::isFinished() const
@@ -88,19 +156,173 @@ bool AnimatedImage::isFinished() const
     if (looping)
         return false;
 
-    return hasDisplayedFrame && currentIndex + 1 >= frames.size();
+    return hasDisplayedFrame && currentIndex + 1 >= store().size();
+}
+
+bool AnimatedImage::nextChangeTimestamp(uint32_t nowMs, uint32_t& timestampMs) const
+{
+    if (nextFrameTimestamp(nowMs, timestampMs))
+        return true;
+
+    // a staged sequence replaces a still frame right away
+    if (!swapPending)
+        return false;
+
+    timestampMs = nowMs;
+    return true;
+}
+
+// frame boundary of the current sequence alone
+bool AnimatedImage::nextFrameTimestamp(uint32_t nowMs, uint32_t& timestampMs) const
+{
+    if (store().empty())
+        return false;
+
+    const bool durations = store().hasDurations();
+    if (!hasDisplayedFrame || seekPending || (!durations && timeline.getStepDuration() == 0))
+    {
+        timestampMs = nowMs;
+        return true;
+    }
+
+    // a single frame, or the last frame of a one-shot sequence, stays put
+    if (store().size() == 1 || (!looping && currentIndex + 1 >= store().size()))
+        return false;
+
+    timestampMs = durations ? sequenceStartMs + store().frameStartMs(currentIndex) + store().durationMs(currentIndex)
+                            : timeline.nextStepTimestamp();
+    return true;
 }
 
 size_t AnimatedImage::frameCount() const
 {
-    return frames.size();
+    return store().size();
+}
+
+Image AnimatedImage::frame(size_t index) const
+{
+    return store().frame(index);
+}
+
+size_t AnimatedImage::encodedBytes() const
+{
+    return store().encodedBytes();
+}
+
+// true once the current frame's time is up; `overshootMs` is how long ago that was
+bool AnimatedImage::swapDue(uint32_t nowMs, uint32_t& overshootMs) const
+{
+    overshootMs = 0;
+    if (!hasDisplayedFrame)
+        return true;
+
+    uint32_t boundaryMs = 0;
+    if (!nextFrameTimestamp(nowMs, boundaryMs))
+        return true;
+
+    const int32_t late = static_cast<int32_t>(nowMs - boundaryMs);
+    if (late < 0)
+        return false;
+
+    overshootMs = static_cast<uint32_t>(late);
+    return true;
+}
+
+void AnimatedImage::swapStaged(uint32_t nowMs, uint32_t overshootMs)
+{
+    // position on the new sequence, measured from the boundary so playback stays on the grid
+    const uint32_t positionMs = stagedKeepPhase ? playbackPosition(nowMs) : overshootMs;
+    const bool     restart    = hasDisplayedFrame;
+
+    frames      = std::move(stagedFrames);
+    cursor      = FrameStore::Cursor{};
+    swapPending = false;
+
+    // the new sequence starts through the seek path unless a seek is already queued
+    if (restart && !seekPending && !store().empty())
+    {
+        seekPending    = true;
+        seekPositionMs = positionMs;
+    }
+}
+
+uint32_t AnimatedImage::playbackPosition(uint32_t nowMs) const
+{
+    if (!hasDisplayedFrame || store().empty())
+        return 0;
+
+    if (store().hasDurations())
+        return nowMs - sequenceStartMs;
+
+    const uint32_t step = timeline.getStepDuration();
+    if (step == 0)
+        return 0;
+
+    return static_cast<uint32_t>(currentIndex) * step + (nowMs - (timeline.nextStepTimestamp() - step));
+}
+
+void AnimatedImage::startAt(uint32_t nowMs, uint32_t positionMs)
+{
+    const size_t count = store().size();
+    hasDisplayedFrame  = true;
+
+    if (store().hasDurations())
+    {
+        sequenceStartMs = nowMs - positionMs;
+        currentIndex    = kNoFrame;
+        showFrameAt(nowMs);
+        return;
+    }
+
+    // uniform durations: frame index plus the phase within that frame
+    const uint32_t step  = timeline.getStepDuration();
+    size_t         index = (step > 0) ? positionMs / step : 0;
+    index = looping ? index % count : std::min(index, count - 1);
+
+    timeline.start(nowMs - ((step > 0) ? positionMs % step : 0));
+    currentIndex = index;
+    showFrame(currentIndex);
+}
+
+void AnimatedImage::showFrameAt(uint32_t nowMs)
+{
+    const uint32_t total   = store().totalDurationMs();
+    uint32_t       elapsed = nowMs - sequenceStartMs;
+
+    // keep the start within the current cycle so the arithmetic never wraps
+    if (looping && elapsed >= total)
+    {
+        sequenceStartMs += (elapsed / total) * total;
+        elapsed         %= total;
+    }
+
+    const size_t index = store().frameAt(elapsed);
+    if (index != currentIndex)
+    {
+        currentIndex = index;
+        showFrame(currentIndex);
+    }
 }
 
 void AnimatedImage::showFrame(size_t index)
 {
-    if (index >= frames.size())
+    if (index >= store().size())
         return;
 
-    frames[index].draw(matrix);
+    // sequential playback decodes a single delta here
+    store().seek(cursor, index);
+    cursor.toImage().draw(matrix);
+    frameChanged = true;
 }
 
+void AnimatedImage::clearFrame()
+{
+    matrix.clear();
+    frameChanged = true;
+}
+
+const FrameStore& AnimatedImage::store() const
+{
+    static const FrameStore kEmpty;
+    return frames ? *frames : kEmpty;
+}
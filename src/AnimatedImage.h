@@ -4,6 +4,8 @@
 #include <vector>
 
 #include "config.h"
+#include "AnimationTimeline.h"
+#include "FrameStore.h"
 #include "Image.h"
 #include "Matrix16x16.h"
 
@@ -13,6 +15,19 @@ public:
     void clearFrames();
     void setFrames(const std::vector<Image>& frames);
 
+    // Adopt a shared, immutable sequence without copying it; the caller may
+    // keep its handle (e.g. to report the first frame).
+    void                 setFrames(FrameSequence frames);
+    const FrameSequence& getFrames() const;
+
+    // Queue `frames` while the current sequence keeps playing; it takes over
+    // at the next frame boundary (right away if nothing is animating). With
+    // `keepPhase` the new sequence continues at the current playback position
+    // instead of starting from its first frame. Staging again replaces the
+    // queued sequence; setFrames() drops it.
+    void stageFrames(FrameSequence frames, bool keepPhase = false);
+    bool hasStagedFrames() const;
+
     void     setFrameDuration(uint32_t milliseconds);
     uint32_t getFrameDuration() const;
 
@@ -21,18 +36,51 @@ public:
 
     void        reset();
     Matrix16x16 update(uint32_t nowMs);
+
+    // Jump to `positionMs` into the sequence at the next update(), e.g. to
+    // start in sync with another panel; frames are located by binary search
+    // when the sequence has per-frame durations.
+    void        seek(uint32_t positionMs);
+
+    // Advance to `nowMs` and copy the frame into `target` only if it differs
+    // from the last one rendered; returns false (target untouched) otherwise.
+    bool        render(Matrix16x16& target, uint32_t nowMs);
     bool        isFinished() const;
     size_t      frameCount() const;
+    Image       frame(size_t index) const;
+    size_t      encodedBytes() const;
+
+    // When update() will next produce a different frame: false if the output
+    // stays as it is until the animation is reconfigured.
+    bool nextChangeTimestamp(uint32_t nowMs, uint32_t& timestampMs) const;
 
 private:
-    void showFrame(size_t index);
+    void     advance(uint32_t nowMs);
+    bool     swapDue(uint32_t nowMs, uint32_t& overshootMs) const;
+    void     swapStaged(uint32_t nowMs, uint32_t overshootMs);
+    uint32_t playbackPosition(uint32_t nowMs) const;
+    bool     nextFrameTimestamp(uint32_t nowMs, uint32_t& timestampMs) const;
+    void     startAt(uint32_t nowMs, uint32_t positionMs);
+    void     showFrameAt(uint32_t nowMs);
+    void     showFrame(size_t index);
+    void     clearFrame();
+    const FrameStore& store() const; // empty store while no sequence is set
 
     Matrix16x16        matrix;
-    std::vector<Image> frames;
+    bool               frameChanged       = true; // matrix redrawn since the last render()
+    FrameSequence      frames;
+    FrameStore::Cursor cursor;             // decoded frame, advanced lazily by showFrame()
     bool               looping            = DEFAULT_IMAGE_LOOPING;
-    uint32_t           frameDurationMs    = DEFAULT_IMAGE_FRAME_DURATION_MS;
-    uint32_t           lastFrameTimestamp = 0;
+    AnimationTimeline  timeline{DEFAULT_IMAGE_FRAME_DURATION_MS};
     size_t             currentIndex       = 0;
     bool               hasDisplayedFrame  = false;
+    uint32_t           sequenceStartMs    = 0;     // per-frame durations: start of the current cycle
+    bool               seekPending        = false;
+    uint32_t           seekPositionMs     = 0;
+    FrameSequence      stagedFrames;                // takes over at the next frame boundary
+    bool               swapPending        = false;
+    bool               stagedKeepPhase    = false;
+
+    static constexpr size_t kNoFrame = FrameStore::kNoFrame;
 };
 
@@ -4,25 +4,30 @@
 
 #include "font8x8_basic.h"
 
-// Helper to iterate font bits; glyph data already matches the matrix orientation
-static bool glyphPixelOn(const uint8_t glyph[8], int col, int row)
+// Font rows store the leftmost column in bit 0; matrix rows keep x = 0 in the
+// most significant bit. Mirror one glyph row and widen every column to `scale` bits.
+static uint16_t glyphRowBits(uint8_t fontBits, int scale)
 {
-    if (row < 0 || row >= 8 || col < 0 || col >= 8)
-        return false;
-
-    uint8_t rowBits = glyph[row];
-    return ((rowBits >> col) & 0x1u) != 0u;
+    uint16_t bits = 0;
+    for (int col = 0; col < 8; ++col)
+    {
+        const uint16_t column = ((fontBits >> col) & 0x1u) ? static_cast<uint16_t>((1u << scale) - 1u) : 0u;
+        bits = static_cast<uint16_t>((bits << scale) | column);
+    }
+    return bits;
 }
 
 void AnimatedText::setText(const std::string& text)
 {
-    message = text;
+    message    = text;
+    stripDirty = true;
     reset();
 }
 
 void AnimatedText::setText(const char* text)
 {
-    message = text ? std::string(text) : std::string();
+    message    = text ? std::string(text) : std::string();
+    stripDirty = true;
     reset();
 }
 
@@ -31,6 +36,31 @@ const std::string& AnimatedText::getText() const
     return message;
 }
 
+size_t AnimatedText::appendText(const std::string& text)
+{
+    // an idle ticker restarts its timeline, so new text enters from the right
+    // edge instead of catching up on the time spent idle
+    if (mode == AnimationMode::Ticker && tickerCount == 0)
+        displayedIndex = -1;
+
+    size_t appended = 0;
+    for (char c : text)
+    {
+        if (tickerCount >= tickerRing.size())
+            break;
+
+        tickerRing[(tickerHead + tickerCount) % tickerRing.size()] = c;
+        ++tickerCount;
+        ++appended;
+    }
+    return appended;
+}
+
+size_t AnimatedText::getTickerPending() const
+{
+    return tickerCount;
+}
+
 void AnimatedText::setAnimationMode(AnimationMode newMode)
 {
     if (mode == newMode)
@@ -47,16 +77,19 @@ AnimatedText::AnimationMode AnimatedText::getAnimationMode() const
 
 void AnimatedText::setFrameDuration(uint32_t milliseconds)
 {
-    frameDurationMs = milliseconds;
+    timeline.setStepDuration(milliseconds);
 }
 
 uint32_t AnimatedText::getFrameDuration() const
 {
-    return frameDurationMs;
+    return timeline.getStepDuration();
 }
 
 void AnimatedText::setLooping(bool enable)
 {
+    if (looping != enable)
+        stripDirty = true;
+
     looping = enable;
     if (looping && !message.empty() && nextIndex == message.size())
     {
@@ -75,6 +108,7 @@ void AnimatedText::setVerticalAlignment(VerticalAlignment alignment)
         return;
 
     verticalAlignment = alignment;
+    stripDirty        = true;
     reset();
 }
 
@@ -85,15 +119,47 @@ AnimatedText::VerticalAlignment AnimatedText::getVerticalAlignment() const
 
 void AnimatedText::reset()
 {
-    nextIndex          =  0;
-    displayedIndex     = -1;
-    lastFrameTimestamp =  0;
-    scrollOffset       =  0;
-    matrix.clear();
+    nextIndex      =  0;
+    displayedIndex = -1;
+    scrollOffset   =  0;
+    timeline.stop();
+    clearFrame();
+
+    // the ticker starts over with the configured text entering from the right
+    tickerHead   = 0;
+    tickerCount  = 0;
+    tickerOffset = -LED_MATRIX_COLS;
+    if (mode == AnimationMode::Ticker)
+    {
+        appendText(message);
+    }
 }
 
 Matrix16x16 AnimatedText::update(uint32_t nowMs)
 {
+    advance(nowMs);
+    return matrix;
+}
+
+bool AnimatedText::render(Matrix16x16& target, uint32_t nowMs)
+{
+    advance(nowMs);
+    if (!frameChanged)
+        return false;
+
+    target.copyFrom(matrix);
+    frameChanged = false;
+    return true;
+}
+
+void AnimatedText::advance(uint32_t nowMs)
+{
+    if (mode == AnimationMode::Ticker)
+    {
+        updateTicker(nowMs);
+        return;
+    }
+
     if (message.empty())
     {
         if (displayedIndex != -1)
@@ -101,9 +167,9 @@ Matrix16x16 AnimatedText::update(uint32_t nowMs)
             displayedIndex = -1;
             nextIndex = 0;
             scrollOffset = 0;
-            matrix.clear();
+            clearFrame();
         }
-        return matrix;
+        return;
     }
 
     if (mode == AnimationMode::Scroll)
@@ -114,13 +180,11 @@ Matrix16x16 AnimatedText::update(uint32_t nowMs)
     {
         updateHold(nowMs);
     }
-
-    return matrix;
 }
 
 bool AnimatedText::isFinished() const
 {
-    if (looping)
+    if (looping || mode == AnimationMode::Ticker)
         return false;
 
     if (message.empty())
@@ -136,6 +200,9 @@ bool AnimatedText::isFinished() const
 
 char AnimatedText::currentChar() const
 {
+    if (mode == AnimationMode::Ticker)
+        return (tickerCount > 0 && tickerOffset >= 0) ? tickerCharAt(0) : '\0';
+
     if (displayedIndex < 0)
         return '\0';
 
@@ -146,6 +213,41 @@ char AnimatedText::currentChar() const
     return message[idx];
 }
 
+bool AnimatedText::nextChangeTimestamp(uint32_t nowMs, uint32_t& timestampMs) const
+{
+    if (mode == AnimationMode::Ticker)
+    {
+        // idle until text is appended
+        if (displayedIndex != -1 && tickerCount == 0)
+            return false;
+    }
+    else if (message.empty())
+    {
+        if (displayedIndex == -1)
+            return false;
+
+        timestampMs = nowMs; // the last frame still has to be cleared
+        return true;
+    }
+    else if (isFinished())
+    {
+        return false;
+    }
+    else if (mode == AnimationMode::Hold && displayedIndex != -1 && message.size() == 1)
+    {
+        return false; // redrawing the same glyph
+    }
+
+    if (displayedIndex == -1 || timeline.getStepDuration() == 0)
+    {
+        timestampMs = nowMs;
+        return true;
+    }
+
+    timestampMs = timeline.nextStepTimestamp();
+    return true;
+}
+
 void AnimatedText::updateHold(uint32_t nowMs)
 {
     if (!looping && displayedIndex >= 0 && nextIndex >= message.size())
@@ -153,33 +255,33 @@ void AnimatedText::updateHold(uint32_t nowMs)
         return;
     }
 
-    bool shouldDraw = false;
     size_t indexToDraw = 0;
 
     if (displayedIndex == -1)
     {
-        shouldDraw = true;
-        indexToDraw = 0;
+        timeline.start(nowMs);
     }
-    else if (frameDurationMs == 0 || (nowMs - lastFrameTimestamp) >= frameDurationMs)
+    else
     {
-        if (nextIndex >= message.size())
-        {
-            if (!looping)
-                return;
+        const uint32_t steps = timeline.advance(nowMs);
+        if (steps == 0)
+            return;
 
-            nextIndex = 0;
+        // skip the characters whose time already passed during a stall
+        const size_t current = static_cast<size_t>(displayedIndex);
+        if (looping)
+        {
+            indexToDraw = (current + steps % message.size()) % message.size();
+        }
+        else
+        {
+            const size_t remaining = message.size() - 1 - current;
+            indexToDraw = (steps >= remaining) ? message.size() - 1 : current + steps;
         }
-        indexToDraw = nextIndex;
-        shouldDraw = true;
     }
 
-    if (!shouldDraw)
-        return;
-
     drawCharacter(message[indexToDraw]);
     displayedIndex = static_cast<int>(indexToDraw);
-    lastFrameTimestamp = nowMs;
 
     size_t candidate = indexToDraw + 1;
     if (candidate >= message.size())
@@ -197,61 +299,53 @@ void AnimatedText::updateScroll(uint32_t nowMs)
     if (!looping && displayedIndex == -1 && nextIndex >= message.size())
         return;
 
-    const int glyphWidth = glyphPixelWidth();
-
-    if (displayedIndex == -1)
-    {
-        displayedIndex = 0;
-        if (message.size() <= 1)
-        {
-            nextIndex = looping ? 0 : message.size();
-        }
-        else
-        {
-            nextIndex = 1;
-        }
-        scrollOffset = 0;
-
-        drawScrollFrame(scrollOffset);
-        lastFrameTimestamp = nowMs;
-        return;
-    }
-
-    if (frameDurationMs > 0 && (nowMs - lastFrameTimestamp) < frameDurationMs)
-        return;
+    const uint32_t glyphWidth = static_cast<uint32_t>(glyphPixelWidth());
+    uint32_t       position   = 0;
 
-    lastFrameTimestamp = nowMs;
-    scrollOffset += 1;
-
-    if (scrollOffset >= glyphWidth)
-    {
-        scrollOffset = 0;
-
-        if (nextIndex >= message.size())
-        {
-            if (!looping)
-            {
-                displayedIndex = -1;
-                nextIndex = message.size();
-                matrix.clear();
-                return;
-            }
-            nextIndex = 0;
-        }
+    if (displayedIndex == -1)
+    {
+        timeline.start(nowMs);
+    }
+    else
+    {
+        const uint32_t steps = timeline.advance(nowMs);
+        if (steps == 0)
+            return;
 
-        displayedIndex = static_cast<int>(nextIndex);
+        // one pixel per step; after a stall jump straight to where the text should be
+        const uint32_t textWidth = static_cast<uint32_t>(message.size()) * glyphWidth;
+        position = static_cast<uint32_t>(displayedIndex) * glyphWidth + static_cast<uint32_t>(scrollOffset);
 
-        size_t upcoming = static_cast<size_t>(displayedIndex) + 1;
-        if (upcoming >= message.size())
+        if (looping)
+        {
+            position = (position + steps % textWidth) % textWidth;
+        }
+        else if (steps >= textWidth - position)
         {
-            nextIndex = looping ? 0 : message.size();
+            displayedIndex = -1;
+            nextIndex = message.size();
+            clearFrame();
+            return;
         }
         else
         {
-            nextIndex = upcoming;
+            position += steps;
         }
     }
 
+    displayedIndex = static_cast<int>(position / glyphWidth);
+    scrollOffset   = static_cast<int>(position % glyphWidth);
+
+    size_t upcoming = static_cast<size_t>(displayedIndex) + 1;
+    if (upcoming >= message.size())
+    {
+        nextIndex = looping ? 0 : message.size();
+    }
+    else
+    {
+        nextIndex = upcoming;
+    }
+
     drawScrollFrame(scrollOffset);
 }
 
@@ -259,76 +353,158 @@ void AnimatedText::drawGlyphAtOffset(const uint8_t* glyph, int offsetX)
 {
     const int horizontalScale = this->horizontalScale();
     const int verticalScale   = this->verticalScale();
-    const int verticalOffset  = (verticalAlignment == VerticalAlignment::LowerHalf)
-                                    ? (LED_MATRIX_ROWS - 8 * verticalScale)
-                                    : 0;
 
-    for (int row = 0; row < 8; ++row)
-    {
-        for (int col = 0; col < 8; ++col)
-        {
-            if (!glyphPixelOn(glyph, col, row))
-                continue;
-
-            const int baseX = offsetX + col * horizontalScale;
-            const int baseY = verticalOffset + row * verticalScale;
-
-            for (int dy = 0; dy < verticalScale; ++dy)
-            {
-                for (int dx = 0; dx < horizontalScale; ++dx)
-                {
-                    matrix.setPixel(baseX + dx, baseY + dy, true);
-                }
-            }
+    // scaled glyph as a bitmap of up to 16x16, blitted whole rows at a time
+    uint16_t rows[16];
+    for (int row = 0; row < 8; ++row)
+    {
+        const uint16_t bits = glyphRowBits(glyph[row], horizontalScale);
+        for (int dy = 0; dy < verticalScale; ++dy)
+        {
+            rows[row * verticalScale + dy] = bits;
         }
     }
+
+    matrix.blit(rows, 8 * horizontalScale, 8 * verticalScale, offsetX, verticalOffset(), BlitOp::Or);
 }
 
 void AnimatedText::drawScrollFrame(int offset)
 {
-    matrix.clear();
+    clearFrame();
 
     if (message.empty() || displayedIndex < 0)
         return;
 
-    const int glyphWidth = glyphPixelWidth();
-    int       drawX      = -offset;
+    if (stripDirty)
+        renderStrip();
 
-    size_t glyphIndex = static_cast<size_t>(displayedIndex);
-    char   current    = message[glyphIndex];
-    bool   hasGlyphs  = true;
+    // the visible window spans at most a few strip words; each blit shifts a whole word column
+    const int start     = displayedIndex * glyphPixelWidth() + offset;
+    const int firstWord = start / 32;
+    const int lastWord  = (start + LED_MATRIX_COLS - 1) / 32;
 
-    while (drawX < LED_MATRIX_COLS)
+    for (int word = firstWord; word <= lastWord && word < stripWordColumns; ++word)
     {
-        drawGlyphAtOffset(font8x8_basic[static_cast<uint8_t>(current)], drawX);
-        drawX += glyphWidth;
+        matrix.blit(&strip[static_cast<size_t>(word) * stripRows], 32, stripRows, word * 32 - start, verticalOffset(), BlitOp::Or);
+    }
+}
+
+void AnimatedText::renderStrip()
+{
+    const int horizontalScale = this->horizontalScale();
+    const int verticalScale   = this->verticalScale();
+    const int glyphWidth      = glyphPixelWidth();
+
+    // trailing glyphs so the last window of the message is complete
+    const int tailGlyphs  = (LED_MATRIX_COLS + glyphWidth - 1) / glyphWidth;
+    const int glyphCount  = static_cast<int>(message.size()) + tailGlyphs;
+    const int stripWidth  = glyphCount * glyphWidth;
+
+    stripRows        = 8 * verticalScale;
+    stripWordColumns = (stripWidth + 31) / 32;
+    strip.assign(static_cast<size_t>(stripWordColumns) * stripRows, 0u);
+
+    for (int glyphIndex = 0; glyphIndex < glyphCount && !message.empty(); ++glyphIndex)
+    {
+        char c = ' ';
+        if (glyphIndex < static_cast<int>(message.size()))
+            c = message[glyphIndex];
+        else if (looping)
+            c = message[glyphIndex % message.size()];
+
+        const uint8_t* glyph = font8x8_basic[static_cast<uint8_t>(c)];
+        const int      x     = glyphIndex * glyphWidth;
+        const int      word  = x / 32;
+        const int      shift = 64 - (x % 32) - glyphWidth; // position inside a two-word window
+
+        for (int row = 0; row < stripRows; ++row)
+        {
+            const uint64_t bits = static_cast<uint64_t>(glyphRowBits(glyph[row / verticalScale], horizontalScale)) << shift;
 
-        if (!hasGlyphs)
-            continue;
+            strip[static_cast<size_t>(word) * stripRows + row] |= static_cast<uint32_t>(bits >> 32);
+            if (word + 1 < stripWordColumns)
+                strip[static_cast<size_t>(word + 1) * stripRows + row] |= static_cast<uint32_t>(bits);
+        }
+    }
+
+    stripDirty = false;
+}
+
+void AnimatedText::updateTicker(uint32_t nowMs)
+{
+    if (displayedIndex == -1)
+    {
+        displayedIndex = 0;
+        timeline.start(nowMs);
+        drawTickerFrame();
+        return;
+    }
+
+    const uint32_t steps = timeline.advance(nowMs);
+    if (steps == 0)
+        return;
+
+    // idle: nothing queued and the panel is already blank
+    if (tickerCount == 0)
+        return;
+
+    const int      glyphWidth = glyphPixelWidth();
+    const uint32_t remaining  = static_cast<uint32_t>(static_cast<int>(tickerCount) * glyphWidth - tickerOffset);
+
+    if (steps >= remaining)
+    {
+        // everything queued has scrolled off; text appended later enters from the right edge again
+        tickerHead   = (tickerHead + tickerCount) % tickerRing.size();
+        tickerCount  = 0;
+        tickerOffset = -LED_MATRIX_COLS;
+    }
+    else
+    {
+        tickerOffset += static_cast<int>(steps);
 
-        size_t nextGlyph = glyphIndex + 1;
-        if (nextGlyph >= message.size())
+        // release characters that have scrolled off completely
+        while (tickerOffset >= glyphWidth)
         {
-            if (!looping)
-            {
-                hasGlyphs = false;
-                current   = ' ';
-                continue;
-            }
-            nextGlyph = 0;
+            tickerHead    = (tickerHead + 1) % tickerRing.size();
+            tickerCount  -= 1;
+            tickerOffset -= glyphWidth;
         }
+    }
+
+    drawTickerFrame();
+}
+
+void AnimatedText::drawTickerFrame()
+{
+    clearFrame();
 
-        glyphIndex = nextGlyph;
-        current    = message[glyphIndex];
+    const int glyphWidth = glyphPixelWidth();
+    int       drawX      = -tickerOffset;
+
+    for (size_t index = 0; index < tickerCount && drawX < LED_MATRIX_COLS; ++index)
+    {
+        drawGlyphAtOffset(font8x8_basic[static_cast<uint8_t>(tickerCharAt(index))], drawX);
+        drawX += glyphWidth;
     }
 }
 
+char AnimatedText::tickerCharAt(size_t index) const
+{
+    return tickerRing[(tickerHead + index) % tickerRing.size()];
+}
+
 void AnimatedText::drawCharacter(char c)
 {
-    matrix.clear();
+    clearFrame();
     drawGlyphAtOffset(font8x8_basic[static_cast<uint8_t>(c)], 0);
 }
 
+void AnimatedText::clearFrame()
+{
+    matrix.clear();
+    frameChanged = true;
+}
+
 int AnimatedText::horizontalScale() const
 {
     return (verticalAlignment == VerticalAlignment::Full) ? 2 : 1;
@@ -339,6 +515,11 @@ int AnimatedText::verticalScale() const
     return (verticalAlignment == VerticalAlignment::Full) ? 2 : 1;
 }
 
+int AnimatedText::verticalOffset() const
+{
+    return (verticalAlignment == VerticalAlignment::LowerHalf) ? (LED_MATRIX_ROWS - 8 * verticalScale()) : 0;
+}
+
 int AnimatedText::glyphPixelWidth() const
 {
     return horizontalScale() * 8;
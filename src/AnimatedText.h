@@ -1,9 +1,13 @@
 ﻿#pragma once
 
 #include <stdint.h>
+#include <stddef.h>
+#include <array>
 #include <string>
+#include <vector>
 
 #include "config.h"
+#include "AnimationTimeline.h"
 #include "Matrix16x16.h"
 
 class AnimatedText
@@ -12,7 +16,8 @@ public:
     enum class AnimationMode
     {
         Hold,
-        Scroll
+        Scroll,
+        Ticker  // scrolls through appended text; see appendText()
     };
     enum class VerticalAlignment
     {
@@ -25,6 +30,12 @@ public:
     void               setText(const char* text);
     const std::string& getText() const;
 
+    // Ticker mode: queue text behind what is already scrolling without restarting it.
+    // Characters are released once they have left the panel; returns how many of
+    // `text` fit into the TEXT_TICKER_CAPACITY ring buffer.
+    size_t appendText(const std::string& text);
+    size_t getTickerPending() const;
+
     void          setAnimationMode(AnimationMode newMode);
     AnimationMode getAnimationMode() const;
 
@@ -39,27 +50,57 @@ public:
 
     void        reset();
     Matrix16x16 update(uint32_t nowMs);
+
+    // Advance to `nowMs` and copy the frame into `target` only if it differs
+    // from the last one rendered; returns false (target untouched) otherwise.
+    bool        render(Matrix16x16& target, uint32_t nowMs);
     bool        isFinished() const;
     char        currentChar() const;
 
+    // When update() will next produce a different frame: false if the output
+    // stays as it is until the text or mode changes (or text is appended).
+    bool nextChangeTimestamp(uint32_t nowMs, uint32_t& timestampMs) const;
+
 private:
+    void advance(uint32_t nowMs);
     void updateHold(uint32_t nowMs);
     void updateScroll(uint32_t nowMs);
+    void updateTicker(uint32_t nowMs);
+    void drawTickerFrame();
+    char tickerCharAt(size_t index) const;
     void drawGlyphAtOffset(const uint8_t* glyph, int offsetX);
     void drawScrollFrame(int offset);
     void drawCharacter(char c);
+    void renderStrip();
+    void clearFrame();
     int  horizontalScale() const;
     int  verticalScale() const;
+    int  verticalOffset() const;
     int  glyphPixelWidth() const;
 
     Matrix16x16   matrix;
+    bool          frameChanged         =  true; // matrix redrawn since the last render()
     std::string   message              =  DEFAULT_INITIAL_TEXT;
     bool          looping              =  DEFAULT_TEXT_LOOPING;
     AnimationMode mode                 =  (AnimationMode)DEFAULT_TEXT_ANIMATION_MODE;
     VerticalAlignment verticalAlignment = VerticalAlignment::Full;
-    uint32_t      frameDurationMs      =  DEFAULT_TEXT_ANIMATION_MODE==0 ? DEFAULT_TEXT_FRAME_DURATION_HOLD_MS : DEFAULT_TEXT_FRAME_DURATION_LOOP_MS;
-    uint32_t      lastFrameTimestamp   =  0;
+    AnimationTimeline timeline{DEFAULT_TEXT_ANIMATION_MODE==0 ? DEFAULT_TEXT_FRAME_DURATION_HOLD_MS : DEFAULT_TEXT_FRAME_DURATION_LOOP_MS};
     size_t        nextIndex            =  0;
     int           displayedIndex       = -1;
     int           scrollOffset         =  0;
+
+    // message rasterized once at the current scale for scrolling, plus enough
+    // trailing columns (wrapped text or blank) to fill the panel at the end;
+    // 32-column word j of glyph row r lives at strip[j * stripRows + r]
+    std::vector<uint32_t> strip;
+    int                   stripRows        = 0;
+    int                   stripWordColumns = 0;
+    bool                  stripDirty       = true;
+
+    // ticker ring buffer; tickerOffset is the scroll position of the oldest
+    // character in pixels (negative while text enters from the right edge)
+    std::array<char, TEXT_TICKER_CAPACITY> tickerRing{};
+    size_t                                 tickerHead   = 0;
+    size_t                                 tickerCount  = 0;
+    int                                    tickerOffset = -LED_MATRIX_COLS;
 };
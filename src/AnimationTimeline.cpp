@@ -0,0 +1,58 @@
+#include "AnimationTimeline.h"
+
+AnimationTimeline::AnimationTimeline(uint32_t stepDurationMs)
+    : stepDurationMs(stepDurationMs)
+{
+}
+
+void AnimationTimeline::start(uint32_t nowMs)
+{
+    lastStepMs = nowMs;
+    running    = true;
+}
+
+void AnimationTimeline::stop()
+{
+    running = false;
+}
+
+bool AnimationTimeline::isRunning() const
+{
+    return running;
+}
+
+void AnimationTimeline::setStepDuration(uint32_t milliseconds)
+{
+    stepDurationMs = milliseconds;
+}
+
+uint32_t AnimationTimeline::getStepDuration() const
+{
+    return stepDurationMs;
+}
+
+uint32_t AnimationTimeline::advance(uint32_t nowMs)
+{
+    if (!running)
+        return 0;
+
+    if (stepDurationMs == 0)
+    {
+        lastStepMs = nowMs;
+        return 1;
+    }
+
+    const int32_t elapsed = static_cast<int32_t>(nowMs - lastStepMs);
+    if (elapsed < static_cast<int32_t>(stepDurationMs))
+        return 0;
+
+    // move by whole steps only, so the remainder carries over to the next call
+    const uint32_t steps = static_cast<uint32_t>(elapsed) / stepDurationMs;
+    lastStepMs += steps * stepDurationMs;
+    return steps;
+}
+
+uint32_t AnimationTimeline::nextStepTimestamp() const
+{
+    return lastStepMs + stepDurationMs;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+// Fixed-step clock shared by the frame animators.
+// Step n is due at start + n * stepDuration, so the cadence does not drift when
+// update() is called late: after a stall advance() reports every step that was
+// missed and the renderer jumps straight to the matching position. Timestamps
+// are compared wrap-safe, so millis() rolling over is harmless; timestamps
+// earlier than the last consumed step count as "no step due".
+class AnimationTimeline
+{
+public:
+    explicit AnimationTimeline(uint32_t stepDurationMs = 0);
+
+    void start(uint32_t nowMs);
+    void stop();
+    bool isRunning() const;
+
+    // 0 makes every advance() call one step
+    void     setStepDuration(uint32_t milliseconds);
+    uint32_t getStepDuration() const;
+
+    // number of steps that became due since the previous call (0 if stopped)
+    uint32_t advance(uint32_t nowMs);
+
+    // due time of the next step; only meaningful while running
+    uint32_t nextStepTimestamp() const;
+
+private:
+    uint32_t stepDurationMs;
+    uint32_t lastStepMs = 0;
+    bool     running    = false;
+};
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <type_traits>
+
+// Fixed-width bit set for rows wider than 64 bits. Bit 0 is the LSB of
+// words[0], so the object's bytes are in the same little-endian order a plain
+// integer of that width would have.
+template <int Bits>
+struct WideBits
+{
+    static constexpr int kWords = (Bits + 31) / 32;
+
+    std::array<uint32_t, kWords> words{};
+
+    WideBits& operator|=(const WideBits& other)
+    {
+        for (int i = 0; i < kWords; ++i)
+            words[i] |= other.words[i];
+        return *this;
+    }
+
+    WideBits& operator&=(const WideBits& other)
+    {
+        for (int i = 0; i < kWords; ++i)
+            words[i] &= other.words[i];
+        return *this;
+    }
+
+    WideBits& operator^=(const WideBits& other)
+    {
+        for (int i = 0; i < kWords; ++i)
+            words[i] ^= other.words[i];
+        return *this;
+    }
+
+    constexpr WideBits operator~() const
+    {
+        WideBits result;
+        for (int i = 0; i < kWords; ++i)
+            result.words[i] = ~words[i];
+        return result;
+    }
+
+    friend WideBits operator<<(const WideBits& value, int count)
+    {
+        WideBits   result;
+        const int  wordShift = count / 32;
+        const int  bitShift  = count % 32;
+        for (int i = kWords - 1; i >= wordShift; --i)
+        {
+            result.words[i] = value.words[i - wordShift] << bitShift;
+            if (bitShift != 0 && i - wordShift > 0)
+                result.words[i] |= value.words[i - wordShift - 1] >> (32 - bitShift);
+        }
+        return result;
+    }
+
+    friend WideBits operator|(WideBits lhs, const WideBits& rhs) { return lhs |= rhs; }
+    friend WideBits operator&(WideBits lhs, const WideBits& rhs) { return lhs &= rhs; }
+    friend WideBits operator^(WideBits lhs, const WideBits& rhs) { return lhs ^= rhs; }
+
+    friend bool operator==(const WideBits& lhs, const WideBits& rhs) { return lhs.words == rhs.words; }
+    friend bool operator!=(const WideBits& lhs, const WideBits& rhs) { return lhs.words != rhs.words; }
+};
+
+// Smallest storage holding `Bits` bits: uint16_t/uint32_t/uint64_t, or WideBits beyond that.
+template <int Bits>
+using BitStorage = std::conditional_t<(Bits <= 16), uint16_t,
+                   std::conditional_t<(Bits <= 32), uint32_t,
+                   std::conditional_t<(Bits <= 64), uint64_t,
+                                                    WideBits<Bits>>>>;
+
+// Bit helpers that compile to plain integer operations for the native types.
+namespace bitops
+{
+template <typename T>
+struct IsWide : std::false_type {};
+
+template <int Bits>
+struct IsWide<WideBits<Bits>> : std::true_type {};
+
+template <typename T>
+inline T bit(int index)
+{
+    if constexpr (IsWide<T>::value)
+    {
+        T result;
+        result.words[index / 32] = 1u << (index % 32);
+        return result;
+    }
+    else
+    {
+        return static_cast<T>(static_cast<T>(1u) << index);
+    }
+}
+
+// lowest `count` bits set
+template <typename T>
+inline T lowMask(int count)
+{
+    if constexpr (IsWide<T>::value)
+    {
+        T result;
+        for (int i = 0; i < T::kWords; ++i)
+        {
+            const int remaining = count - i * 32;
+            result.words[i] = (remaining >= 32) ? 0xFFFFFFFFu : (remaining <= 0 ? 0u : ((1u << remaining) - 1u));
+        }
+        return result;
+    }
+    else
+    {
+        return (count >= static_cast<int>(sizeof(T) * 8)) ? static_cast<T>(~static_cast<T>(0))
+                                                          : static_cast<T>((static_cast<T>(1u) << count) - 1u);
+    }
+}
+
+template <typename T>
+inline bool test(const T& value, int index)
+{
+    if constexpr (IsWide<T>::value)
+    {
+        return (value.words[index / 32] >> (index % 32)) & 0x1u;
+    }
+    else
+    {
+        return (value >> index) & 0x1u;
+    }
+}
+
+template <typename T>
+inline bool any(const T& value)
+{
+    return value != T{};
+}
+
+template <typename T>
+inline int popcount(const T& value)
+{
+    if constexpr (IsWide<T>::value)
+    {
+        int count = 0;
+        for (uint32_t word : value.words)
+            count += __builtin_popcount(word);
+        return count;
+    }
+    else if constexpr (sizeof(T) > sizeof(unsigned int))
+    {
+        return __builtin_popcountll(value);
+    }
+    else
+    {
+        return __builtin_popcount(value);
+    }
+}
+
+// copy `value` into the low bits of a type at least as wide
+template <typename Dst, typename Src>
+inline Dst widen(const Src& value)
+{
+    if constexpr (!IsWide<Dst>::value)
+    {
+        static_assert(!IsWide<Src>::value, "cannot narrow a wide bit set");
+        return static_cast<Dst>(value);
+    }
+    else if constexpr (!IsWide<Src>::value)
+    {
+        Dst result;
+        result.words[0] = static_cast<uint32_t>(value);
+        if constexpr (sizeof(Src) > sizeof(uint32_t))
+        {
+            if (Dst::kWords > 1)
+                result.words[1] = static_cast<uint32_t>(static_cast<uint64_t>(value) >> 32);
+        }
+        return result;
+    }
+    else
+    {
+        static_assert(Src::kWords <= Dst::kWords, "cannot narrow a wide bit set");
+        Dst result;
+        for (int i = 0; i < Src::kWords; ++i)
+            result.words[i] = value.words[i];
+        return result;
+    }
+}
+} // namespace bitops
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <atomic>
+
+// Wait-free single-producer/single-consumer triple buffer.
+//
+// The producer fills writeBuffer() completely and calls publish(), which hands
+// the slot over with a single atomic exchange. The consumer calls acquire() to
+// pick up the newest published slot (again one exchange) and then reads it via
+// readBuffer() for as long as it likes. Neither side ever blocks or copies T,
+// and the consumer never observes a slot the producer is still writing.
+template <typename T>
+class FrameExchange
+{
+public:
+    FrameExchange() = default;
+
+    FrameExchange(const FrameExchange&)            = delete;
+    FrameExchange& operator=(const FrameExchange&) = delete;
+
+    // producer side
+    T& writeBuffer()
+    {
+        return slots[writeIndex];
+    }
+
+    void publish()
+    {
+        const uint8_t previous = shared.exchange(static_cast<uint8_t>(writeIndex | kFreshFlag), std::memory_order_acq_rel);
+        writeIndex = previous & kIndexMask;
+    }
+
+    // consumer side; returns false (and keeps the current slot) when nothing new was published
+    bool acquire()
+    {
+        if ((shared.load(std::memory_order_relaxed) & kFreshFlag) == 0)
+            return false;
+
+        const uint8_t previous = shared.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & kIndexMask;
+        return true;
+    }
+
+    const T& readBuffer() const
+    {
+        return slots[readIndex];
+    }
+
+private:
+    static constexpr uint8_t kIndexMask = 0x03u;
+    static constexpr uint8_t kFreshFlag = 0x04u;
+
+    std::array<T, 3>     slots{};
+    uint8_t              writeIndex = 0;
+    std::atomic<uint8_t> shared{1};
+    uint8_t              readIndex  = 2;
+};
@@ -0,0 +1,336 @@
+#include "FrameStore.h"
+
+#include <algorithm>
+
+namespace
+{
+constexpr uint8_t kZeroRun     = 0x00; // 00nnnnnn
+constexpr uint8_t kLiteral     = 0x40; // 01nnnnnn
+constexpr uint8_t kRepeat      = 0x80; // 1nnnnnnn
+constexpr size_t  kMaxShortRun = 64;
+constexpr size_t  kMaxRepeat   = 128;
+constexpr size_t  kMinRepeat   = 3;    // shorter runs are cheaper as literals
+
+size_t runLength(const FrameStore::Bytes& bytes, size_t start, size_t limit)
+{
+    size_t length = 1;
+    while (start + length < bytes.size() && length < limit && bytes[start + length] == bytes[start])
+    {
+        ++length;
+    }
+    return length;
+}
+} // namespace
+
+Image FrameStore::Cursor::toImage() const
+{
+    Image image;
+    for (int y = 0; y < Image::kHeight; ++y)
+    {
+        image.setRowBytes(y, &bytes[static_cast<size_t>(y) * Image::kRowBytes]);
+    }
+    return image;
+}
+
+FrameStore::FrameStore(size_t keyframeInterval)
+    : keyframeInterval(keyframeInterval > 0 ? keyframeInterval : 1)
+{
+}
+
+void FrameStore::clear()
+{
+    frameCount = 0;
+    poolCount  = 0;
+    data.clear();
+    keyframeOffsets.clear();
+    indices.clear();
+    indexBytes = 1;
+    frameEndsMs.clear();
+    poolByHash.clear();
+    previous.fill(0);
+}
+
+void FrameStore::append(const Image& frame)
+{
+    Bytes bytes;
+    toBytes(frame, bytes);
+    append(bytes);
+}
+
+void FrameStore::append(const Bytes& frame)
+{
+    pushIndex(intern(frame));
+    ++frameCount;
+}
+
+void FrameStore::append(const Image& frame, uint32_t durationMs)
+{
+    const uint32_t start = frameEndsMs.empty() ? 0u : frameEndsMs.back();
+    frameEndsMs.push_back(start + std::max<uint32_t>(durationMs, 1u));
+    append(frame);
+}
+
+void FrameStore::shrinkToFit()
+{
+    data.shrink_to_fit();
+    keyframeOffsets.shrink_to_fit();
+    indices.shrink_to_fit();
+    frameEndsMs.shrink_to_fit();
+
+    std::unordered_multimap<uint32_t, uint32_t>().swap(poolByHash);
+}
+
+size_t FrameStore::size() const
+{
+    return frameCount;
+}
+
+bool FrameStore::empty() const
+{
+    return frameCount == 0;
+}
+
+size_t FrameStore::uniqueCount() const
+{
+    return poolCount;
+}
+
+size_t FrameStore::encodedBytes() const
+{
+    return data.size() + indices.size() + (keyframeOffsets.size() + frameEndsMs.size()) * sizeof(uint32_t);
+}
+
+bool FrameStore::hasDurations() const
+{
+    return frameCount > 0 && frameEndsMs.size() == frameCount;
+}
+
+uint32_t FrameStore::durationMs(size_t index) const
+{
+    if (!hasDurations() || index >= frameCount)
+        return 0;
+
+    return frameEndsMs[index] - frameStartMs(index);
+}
+
+uint32_t FrameStore::frameStartMs(size_t index) const
+{
+    if (!hasDurations() || index == 0 || index > frameCount)
+        return 0;
+
+    return frameEndsMs[index - 1];
+}
+
+uint32_t FrameStore::totalDurationMs() const
+{
+    return hasDurations() ? frameEndsMs.back() : 0;
+}
+
+size_t FrameStore::frameAt(uint32_t positionMs) const
+{
+    if (!hasDurations())
+        return 0;
+
+    // first frame ending after the position
+    const auto it = std::upper_bound(frameEndsMs.begin(), frameEndsMs.end(), positionMs);
+    if (it == frameEndsMs.end())
+        return frameCount - 1;
+
+    return static_cast<size_t>(it - frameEndsMs.begin());
+}
+
+void FrameStore::seek(Cursor& cursor, size_t index) const
+{
+    if (index >= frameCount)
+        return;
+
+    seekPool(cursor, poolIndexAt(index));
+    cursor.index = index;
+}
+
+Image FrameStore::frame(size_t index) const
+{
+    Cursor cursor;
+    seek(cursor, index);
+    return cursor.toImage();
+}
+
+void FrameStore::toBytes(const Image& image, Bytes& bytes)
+{
+    for (int y = 0; y < Image::kHeight; ++y)
+    {
+        image.getRowBytes(y, &bytes[static_cast<size_t>(y) * Image::kRowBytes]);
+    }
+}
+
+// FNV-1a over the packed frame
+uint32_t FrameStore::hashBytes(const Bytes& bytes)
+{
+    uint32_t hash = 2166136261u;
+    for (uint8_t byte : bytes)
+    {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    return hash;
+}
+
+size_t FrameStore::intern(const Bytes& bytes)
+{
+    const uint32_t hash = hashBytes(bytes);
+
+    // hash hits are confirmed against the decoded pool frame
+    const auto range = poolByHash.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second + 1 == poolCount)
+        {
+            if (previous == bytes)
+                return it->second;
+            continue;
+        }
+
+        Cursor probe;
+        seekPool(probe, it->second);
+        if (probe.bytes == bytes)
+            return it->second;
+    }
+
+    if (poolCount % keyframeInterval == 0)
+    {
+        keyframeOffsets.push_back(static_cast<uint32_t>(data.size()));
+        encode(bytes);
+    }
+    else
+    {
+        Bytes delta;
+        for (size_t i = 0; i < delta.size(); ++i)
+        {
+            delta[i] = static_cast<uint8_t>(bytes[i] ^ previous[i]);
+        }
+        encode(delta);
+    }
+
+    previous = bytes;
+    poolByHash.emplace(hash, static_cast<uint32_t>(poolCount));
+    return poolCount++;
+}
+
+void FrameStore::pushIndex(size_t poolIndex)
+{
+    // switch to two-byte indices once the pool outgrows one byte
+    if (poolIndex > 0xFFu && indexBytes == 1)
+    {
+        std::vector<uint8_t> wide;
+        wide.reserve(indices.size() * 2 + 2);
+        for (uint8_t index : indices)
+        {
+            wide.push_back(index);
+            wide.push_back(0);
+        }
+        indices.swap(wide);
+        indexBytes = 2;
+    }
+
+    indices.push_back(static_cast<uint8_t>(poolIndex));
+    if (indexBytes == 2)
+        indices.push_back(static_cast<uint8_t>(poolIndex >> 8));
+}
+
+size_t FrameStore::poolIndexAt(size_t index) const
+{
+    if (indexBytes == 1)
+        return indices[index];
+
+    return static_cast<size_t>(indices[2 * index]) | (static_cast<size_t>(indices[2 * index + 1]) << 8);
+}
+
+void FrameStore::seekPool(Cursor& cursor, size_t poolIndex) const
+{
+    const size_t keyframe = poolIndex - poolIndex % keyframeInterval;
+
+    // restart from the keyframe unless the cursor is already on the way there
+    if (cursor.poolIndex == kNoFrame || cursor.poolIndex > poolIndex || cursor.poolIndex < keyframe)
+    {
+        cursor.nextOffset = decode(keyframeOffsets[keyframe / keyframeInterval], cursor.bytes, true);
+        cursor.poolIndex  = keyframe;
+    }
+
+    while (cursor.poolIndex < poolIndex)
+    {
+        ++cursor.poolIndex;
+        cursor.nextOffset = decode(cursor.nextOffset, cursor.bytes, false);
+    }
+}
+
+void FrameStore::encode(const Bytes& bytes)
+{
+    size_t i = 0;
+    while (i < bytes.size())
+    {
+        if (bytes[i] == 0)
+        {
+            const size_t length = runLength(bytes, i, kMaxShortRun);
+            data.push_back(static_cast<uint8_t>(kZeroRun | (length - 1)));
+            i += length;
+            continue;
+        }
+
+        const size_t repeat = runLength(bytes, i, kMaxRepeat);
+        if (repeat >= kMinRepeat)
+        {
+            data.push_back(static_cast<uint8_t>(kRepeat | (repeat - 1)));
+            data.push_back(bytes[i]);
+            i += repeat;
+            continue;
+        }
+
+        // literal bytes up to the next zero or worthwhile repeat
+        size_t length = 1;
+        while (i + length < bytes.size() && length < kMaxShortRun && bytes[i + length] != 0 &&
+               runLength(bytes, i + length, kMinRepeat) < kMinRepeat)
+        {
+            ++length;
+        }
+
+        data.push_back(static_cast<uint8_t>(kLiteral | (length - 1)));
+        data.insert(data.end(), bytes.begin() + i, bytes.begin() + i + length);
+        i += length;
+    }
+}
+
+// keyframes replace `bytes`, deltas are XORed onto the previous frame in it
+uint32_t FrameStore::decode(uint32_t offset, Bytes& bytes, bool keyframe) const
+{
+    if (keyframe)
+        bytes.fill(0);
+
+    size_t i = 0;
+    while (i < bytes.size())
+    {
+        const uint8_t control = data[offset++];
+
+        if (control & kRepeat)
+        {
+            const size_t  length = (control & 0x7Fu) + 1u;
+            const uint8_t value  = data[offset++];
+            for (size_t end = i + length; i < end; ++i)
+            {
+                bytes[i] ^= value;
+            }
+        }
+        else if (control & kLiteral)
+        {
+            const size_t length = (control & 0x3Fu) + 1u;
+            for (size_t end = i + length; i < end; ++i)
+            {
+                bytes[i] ^= data[offset++];
+            }
+        }
+        else
+        {
+            i += (control & 0x3Fu) + 1u;
+        }
+    }
+
+    return offset;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "config.h"
+#include "Image.h"
+
+// Compressed frame sequence for AnimatedImage.
+//
+// Frames are interned: identical frames are stored once in a pool and the
+// sequence is a list of pool indices (one byte each while the pool holds up
+// to 256 frames, two bytes beyond). Held frames, repeats and ping-pong loops
+// therefore cost one or two bytes per frame.
+//
+// Pool frames are kept in Image's packed byte layout (Image::kTotalBytes,
+// rows of Image::kRowBytes). Every `keyframeInterval`-th pool frame is stored
+// on its own, all others as the XOR delta against the previous pool frame;
+// both are then run-length encoded with one control byte per token:
+//
+//   00nnnnnn              n + 1 zero bytes (unchanged pixels in a delta)
+//   01nnnnnn b0 .. bn     n + 1 literal bytes
+//   1nnnnnnn b            n + 1 copies of b
+//
+// Only keyframe offsets are indexed; pool frames in between are reached by
+// decoding forward, which a Cursor does incrementally so sequential playback
+// decodes at most one delta per frame.
+//
+// Frames may carry their own display duration (all of them or none). These
+// are kept as prefix sums, so the frame shown at a given time within the
+// sequence is found by binary search.
+class FrameStore
+{
+public:
+    using Bytes = std::array<uint8_t, Image::kTotalBytes>;
+
+    static constexpr size_t kNoFrame = static_cast<size_t>(-1);
+
+    // decoded frame plus its position in the pool; advanced by seek()
+    struct Cursor
+    {
+        Bytes    bytes{};
+        size_t   index      = kNoFrame; // position in the sequence
+        size_t   poolIndex  = kNoFrame; // pool frame held in bytes
+        uint32_t nextOffset = 0;        // encoded data of pool frame poolIndex + 1
+
+        Image toImage() const;
+    };
+
+    explicit FrameStore(size_t keyframeInterval = FRAME_STORE_KEYFRAME_INTERVAL);
+
+    void clear();
+    void append(const Image& frame);
+    void append(const Image& frame, uint32_t durationMs); // durations of 0 count as 1 ms
+    void append(const Bytes& frame);                      // already in the packed layout
+
+    // finish the sequence: release the spare capacity left by append() and the
+    // hash table used for interning; frames appended later are not deduplicated
+    void shrinkToFit();
+
+    size_t size() const;
+    bool   empty() const;
+    size_t uniqueCount() const;
+
+    // per-frame durations; without them the player's uniform frame duration applies
+    bool     hasDurations() const;
+    uint32_t durationMs(size_t index) const;
+    uint32_t frameStartMs(size_t index) const;
+    uint32_t totalDurationMs() const;
+
+    // frame shown `positionMs` into the sequence (the last one beyond its end)
+    size_t frameAt(uint32_t positionMs) const;
+
+    // heap used by the frame pool, the sequence indices and the keyframe index
+    size_t encodedBytes() const;
+
+    // decode frame `index` into `cursor`, reusing what the cursor already holds
+    // when it sits between the pool frame's keyframe and the frame itself
+    void  seek(Cursor& cursor, size_t index) const;
+    Image frame(size_t index) const;
+
+    static void     toBytes(const Image& image, Bytes& bytes);
+    static uint32_t hashBytes(const Bytes& bytes);
+
+private:
+    size_t   intern(const Bytes& bytes);
+    void     pushIndex(size_t poolIndex);
+    size_t   poolIndexAt(size_t index) const;
+    void     seekPool(Cursor& cursor, size_t poolIndex) const;
+    void     encode(const Bytes& bytes);
+    uint32_t decode(uint32_t offset, Bytes& bytes, bool keyframe) const;
+
+    size_t                keyframeInterval;
+    size_t                frameCount = 0;
+    size_t                poolCount  = 0;
+    std::vector<uint8_t>  data;            // encoded pool frames
+    std::vector<uint32_t> keyframeOffsets;
+    std::vector<uint8_t>  indices;         // pool index per frame, little-endian
+    uint8_t               indexBytes = 1;
+    std::vector<uint32_t> frameEndsMs;     // prefix sums of the per-frame durations
+    Bytes                 previous{};      // last pool frame, the base of the next delta
+
+    std::unordered_multimap<uint32_t, uint32_t> poolByHash; // only while appending
+};
+
+// Reference-counted handle to a finished sequence. The web layer and the
+// player share one instance; a new upload is swapped in by replacing the handle.
+using FrameSequence = std::shared_ptr<const FrameStore>;
@@ -0,0 +1,102 @@
+#include "GrayscaleMatrix.h"
+
+GrayscaleMatrix::GrayscaleMatrix(int bitDepth)
+{
+    setBitDepth(bitDepth);
+}
+
+void GrayscaleMatrix::clear()
+{
+    for (Matrix16x16& plane : planes)
+    {
+        plane.clear();
+    }
+}
+
+void GrayscaleMatrix::setBitDepth(int depth)
+{
+    if (depth < kMinBitDepth) depth = kMinBitDepth;
+    if (depth > kMaxBitDepth) depth = kMaxBitDepth;
+
+    if (depth == bitDepth)
+        return;
+
+    bitDepth = depth;
+    clear();
+}
+
+int GrayscaleMatrix::getBitDepth() const
+{
+    return bitDepth;
+}
+
+int GrayscaleMatrix::maxLevel() const
+{
+    return (1 << bitDepth) - 1;
+}
+
+void GrayscaleMatrix::setPixel(int x, int y, uint8_t level)
+{
+    if (level > maxLevel())
+        level = static_cast<uint8_t>(maxLevel());
+
+    for (int plane = 0; plane < bitDepth; ++plane)
+    {
+        planes[plane].setPixel(x, y, (level >> plane) & 0x1u);
+    }
+}
+
+uint8_t GrayscaleMatrix::getPixel(int x, int y) const
+{
+    uint8_t level = 0;
+    for (int plane = 0; plane < bitDepth; ++plane)
+    {
+        if (planes[plane].getPixel(x, y))
+        {
+            level |= static_cast<uint8_t>(1u << plane);
+        }
+    }
+    return level;
+}
+
+void GrayscaleMatrix::setPlaneRowBits(int plane, int y, const Matrix16x16::Row& bits)
+{
+    if (plane < 0 || plane >= bitDepth)
+        return;
+
+    planes[plane].setRowBits(y, bits);
+}
+
+Matrix16x16::Row GrayscaleMatrix::getPlaneRowBits(int plane, int y) const
+{
+    if (plane < 0 || plane >= bitDepth)
+        return Matrix16x16::Row{};
+
+    return planes[plane].getRowBits(y);
+}
+
+void GrayscaleMatrix::fromMatrix(const Matrix16x16& matrix, uint8_t level)
+{
+    if (level > maxLevel())
+        level = static_cast<uint8_t>(maxLevel());
+
+    for (int plane = 0; plane < bitDepth; ++plane)
+    {
+        if ((level >> plane) & 0x1u)
+        {
+            planes[plane].copyFrom(matrix);
+        }
+        else
+        {
+            planes[plane].clear();
+        }
+    }
+}
+
+Matrix16x16::Word GrayscaleMatrix::composeRowWord(int plane, int row) const
+{
+    if (plane < 0 || plane >= bitDepth)
+        return Matrix16x16::Word{};
+
+    return planes[plane].composeRowWord(row);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+
+#include "config.h"
+#include "Matrix16x16.h"
+
+// Framebuffer with per-pixel intensity stored as bit planes.
+// Plane k holds bit k of every pixel level as one Matrix16x16::Row per row, so each
+// plane can be shifted out exactly like a Matrix16x16 frame.
+class GrayscaleMatrix
+{
+public:
+    static constexpr int kMinBitDepth = 4;
+    static constexpr int kMaxBitDepth = 6;
+
+    GrayscaleMatrix() = default;
+    explicit GrayscaleMatrix(int bitDepth);
+
+    void clear();
+
+    void setBitDepth(int bitDepth);
+    int  getBitDepth() const;
+    int  maxLevel() const;
+
+    void    setPixel(int x, int y, uint8_t level);
+    uint8_t getPixel(int x, int y) const;
+
+    void             setPlaneRowBits(int plane, int y, const Matrix16x16::Row& bits);
+    Matrix16x16::Row getPlaneRowBits(int plane, int y) const;
+
+    void fromMatrix(const Matrix16x16& matrix, uint8_t level);
+
+    Matrix16x16::Word composeRowWord(int plane, int row) const;
+
+private:
+    std::array<Matrix16x16, kMaxBitDepth> planes{};
+    int                                   bitDepth = kMinBitDepth;
+};
@@ -1,12 +1,10 @@
 #include "Image.h"
 
-#include "Matrix16x16.h"
-
 namespace
 {
-constexpr uint16_t bitMaskForX(int x)
+Image::Row bitMaskForX(int x)
 {
-    return (x < 0 || x >= Image::kSize) ? 0u : static_cast<uint16_t>(1u << (Image::kSize - 1 - x));
+    return (x < 0 || x >= Image::kWidth) ? Image::Row{} : bitops::bit<Image::Row>(Image::kWidth - 1 - x);
 }
 }
 
@@ -17,58 +15,88 @@ Image::Image()
 
 void Image::clear()
 {
-    rows.fill(0);
+    rows.fill(Row{});
 }
 
 void Image::setPixel(int x, int y, bool on)
 {
-    if (x < 0 || x >= kSize || y < 0 || y >= kSize)
+    if (x < 0 || x >= kWidth || y < 0 || y >= kHeight)
         return;
 
-    uint16_t mask = bitMaskForX(x);
+    const Row mask = bitMaskForX(x);
     if (on)
     {
         rows[y] |= mask;
     }
     else
     {
-        rows[y] &= static_cast<uint16_t>(~mask);
+        rows[y] &= static_cast<Row>(~mask);
     }
 }
 
 bool Image::getPixel(int x, int y) const
 {
-    if (x < 0 || x >= kSize || y < 0 || y >= kSize)
+    if (x < 0 || x >= kWidth || y < 0 || y >= kHeight)
         return false;
 
-    uint16_t mask = bitMaskForX(x);
-    return (rows[y] & mask) != 0;
+    return bitops::test(rows[y], kWidth - 1 - x);
 }
 
-void Image::setRow(int y, uint16_t bits)
+void Image::setRow(int y, const Row& bits)
 {
-    if (y < 0 || y >= kSize)
+    if (y < 0 || y >= kHeight)
         return;
 
-    const uint16_t mask = (kSize >= 16) ? 0xFFFF : static_cast<uint16_t>((1u << kSize) - 1u);
-    rows[y] = bits & mask;
+    rows[y] = bits & bitops::lowMask<Row>(kWidth);
 }
 
-uint16_t Image::getRow(int y) const
+Image::Row Image::getRow(int y) const
 {
-    if (y < 0 || y >= kSize)
-        return 0;
+    if (y < 0 || y >= kHeight)
+        return Row{};
 
-    const uint16_t mask = (kSize >= 16) ? 0xFFFF : static_cast<uint16_t>((1u << kSize) - 1u);
-    return rows[y] & mask;
+    return rows[y];
 }
 
-void Image::draw(Matrix16x16& matrix) const
+void Image::setRowBytes(int y, const uint8_t* bytes)
+{
+    if (y < 0 || y >= kHeight)
+        return;
+
+    for (int x = 0; x < kWidth; ++x)
+    {
+        setPixel(x, y, (bytes[x / 8] & (0x80u >> (x % 8))) != 0);
+    }
+}
+
+void Image::getRowBytes(int y, uint8_t* bytes) const
 {
-    matrix.clear();
-    for (int y = 0; y < kSize; ++y)
+    for (int i = 0; i < kRowBytes; ++i)
+    {
+        bytes[i] = 0;
+    }
+
+    for (int x = 0; x < kWidth; ++x)
     {
-        matrix.setRowBits(y, rows[y]);
+        if (getPixel(x, y))
+        {
+            bytes[x / 8] |= static_cast<uint8_t>(0x80u >> (x % 8));
+        }
     }
 }
 
+void Image::draw(Matrix16x16& matrix) const
+{
+    if constexpr (bitops::IsWide<Row>::value)
+    {
+        matrix.clear();
+        for (int y = 0; y < kHeight; ++y)
+        {
+            matrix.setRowBits(y, rows[y]);
+        }
+    }
+    else
+    {
+        matrix.blit(rows.data(), kWidth, kHeight, 0, 0, BlitOp::Copy);
+    }
+}
@@ -3,15 +3,17 @@
 #include <array>
 #include <stdint.h>
 
-class Matrix16x16;
+#include "Matrix16x16.h"
 
 class Image
 {
 public:
-    static constexpr int kSize = 16;
-    static constexpr int kStrideBits = kSize;
-    static constexpr int kRowBytes = kStrideBits / 8;
-    static constexpr int kTotalBytes = kRowBytes * kSize;
+    static constexpr int kWidth      = Matrix16x16::kWidth;
+    static constexpr int kHeight     = Matrix16x16::kHeight;
+    static constexpr int kRowBytes   = (kWidth + 7) / 8;
+    static constexpr int kTotalBytes = kRowBytes * kHeight;
+
+    using Row = Matrix16x16::Row;
 
     Image();
 
@@ -19,12 +21,15 @@ public:
     void setPixel(int x, int y, bool on = true);
     bool getPixel(int x, int y) const;
 
-    void     setRow(int y, uint16_t bits);
-    uint16_t getRow(int y) const;
+    void setRow(int y, const Row& bits);
+    Row  getRow(int y) const;
+
+    // row as kRowBytes bytes, x = 0 in the most significant bit of the first byte
+    void setRowBytes(int y, const uint8_t* bytes);
+    void getRowBytes(int y, uint8_t* bytes) const;
 
     void draw(Matrix16x16& matrix) const;
 
 private:
-    std::array<uint16_t, kSize> rows{};
+    std::array<Row, kHeight> rows{};
 };
-
@@ -0,0 +1,173 @@
+#include "LiveFrameBuffer.h"
+
+#include <algorithm>
+
+namespace
+{
+// ring indices are free-running uint32_t, so the capacity has to divide 2^32
+static_assert(LiveFrameBuffer::kCapacity > 0 && (LiveFrameBuffer::kCapacity & (LiveFrameBuffer::kCapacity - 1)) == 0,
+              "LIVE_FRAME_BUFFER_CAPACITY must be a power of two");
+
+constexpr uint32_t kIntervalWeightShift = 3;   // EWMA weight 1/8
+constexpr uint32_t kMaxIntervalSampleMs = 250; // longer gaps are pauses, not the frame rate
+} // namespace
+
+bool LiveFrameBuffer::push(const uint8_t* bytes, size_t length, uint32_t nowMs)
+{
+    if (bytes == nullptr || length != Image::kTotalBytes)
+    {
+        invalidFrames.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    const uint32_t sampleMs = nowMs - lastArrivalMs;
+    if (hasArrival && sampleMs > 0 && sampleMs <= kMaxIntervalSampleMs)
+    {
+        const int32_t estimate = static_cast<int32_t>(intervalMs16.load(std::memory_order_relaxed));
+        const int32_t error    = static_cast<int32_t>(sampleMs * 16u) - estimate;
+        intervalMs16.store(static_cast<uint32_t>(estimate + error / (1 << kIntervalWeightShift)),
+                           std::memory_order_relaxed);
+    }
+    lastArrivalMs = nowMs;
+    hasArrival    = true;
+    receivedFrames.fetch_add(1, std::memory_order_relaxed);
+
+    const uint32_t writeIndex = head.load(std::memory_order_relaxed);
+    if (writeIndex - tail.load(std::memory_order_acquire) >= kCapacity)
+    {
+        fullDrops.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Slot& slot = slots[writeIndex % kCapacity];
+    std::copy(bytes, bytes + Image::kTotalBytes, slot.bytes.begin());
+    slot.arrivalMs = nowMs;
+    head.store(writeIndex + 1, std::memory_order_release);
+    return true;
+}
+
+bool LiveFrameBuffer::render(Matrix16x16& target, uint32_t nowMs)
+{
+    const size_t   count     = queued();
+    const uint32_t readIndex = tail.load(std::memory_order_relaxed);
+
+    if (!playing)
+    {
+        if (count == 0)
+            return false;
+
+        dueMs           = slots[readIndex % kCapacity].arrivalMs + LIVE_JITTER_DELAY_MS;
+        dueFractionMs16 = 0;
+        if (static_cast<int32_t>(nowMs - dueMs) < 0)
+            return false;
+        playing = true;
+    }
+
+    const int32_t lateMs16 = static_cast<int32_t>(nowMs - dueMs) * 16 - static_cast<int32_t>(dueFractionMs16);
+    if (lateMs16 < 0)
+        return false;
+
+    if (count == 0)
+    {
+        // nothing arrived in time: hold the frame and wait for the next burst
+        underrunCount.fetch_add(1, std::memory_order_relaxed);
+        playing = false;
+        return false;
+    }
+
+    // after a stall every step that was missed is due at once
+    const int32_t  stepMs16 = static_cast<int32_t>(std::max<uint32_t>(intervalMs16.load(std::memory_order_relaxed), 16u));
+    const uint32_t steps    = 1 + static_cast<uint32_t>(lateMs16 / stepMs16);
+
+    size_t take = std::min<size_t>(steps, count);
+    if (count - take > LIVE_JITTER_TARGET_FRAMES)
+    {
+        take = count - LIVE_JITTER_TARGET_FRAMES;
+    }
+
+    const Slot& slot = slots[(readIndex + take - 1) % kCapacity];
+    Image image;
+    for (int y = 0; y < Image::kHeight; ++y)
+    {
+        image.setRowBytes(y, slot.bytes.data() + y * Image::kRowBytes);
+    }
+    image.draw(target);
+    recordLatency(nowMs - slot.arrivalMs);
+
+    // step past the shown frame, corrected by an eighth of how far its
+    // arrival + delay is from the step it was shown at
+    const int32_t shownStepMs16 = static_cast<int32_t>(steps - 1) * stepMs16;
+    const int32_t errorMs16     = static_cast<int32_t>(slot.arrivalMs + LIVE_JITTER_DELAY_MS - dueMs) * 16
+                                  - static_cast<int32_t>(dueFractionMs16) - shownStepMs16;
+    moveDue(shownStepMs16 + stepMs16 + errorMs16 / 8);
+
+    skippedFrames.fetch_add(static_cast<uint32_t>(take - 1), std::memory_order_relaxed);
+    shownFrames.fetch_add(1, std::memory_order_relaxed);
+    tail.store(readIndex + static_cast<uint32_t>(take), std::memory_order_release);
+    return true;
+}
+
+bool LiveFrameBuffer::nextChangeTimestamp(uint32_t nowMs, uint32_t& timestampMs) const
+{
+    (void)nowMs;
+    if (playing)
+    {
+        timestampMs = dueMs + (dueFractionMs16 > 0 ? 1 : 0);
+        return true;
+    }
+
+    if (queued() == 0)
+        return false;
+
+    timestampMs = slots[tail.load(std::memory_order_relaxed) % kCapacity].arrivalMs + LIVE_JITTER_DELAY_MS;
+    return true;
+}
+
+bool LiveFrameBuffer::isPlaying() const
+{
+    return playing;
+}
+
+uint32_t LiveFrameBuffer::averageLatencyMs() const
+{
+    const uint32_t samples = latencySamples.load(std::memory_order_relaxed);
+    return samples == 0 ? 0 : latencySumMs.load(std::memory_order_relaxed) / samples;
+}
+
+void LiveFrameBuffer::resetStats()
+{
+    receivedFrames.store(0, std::memory_order_relaxed);
+    shownFrames.store(0, std::memory_order_relaxed);
+    fullDrops.store(0, std::memory_order_relaxed);
+    skippedFrames.store(0, std::memory_order_relaxed);
+    invalidFrames.store(0, std::memory_order_relaxed);
+    underrunCount.store(0, std::memory_order_relaxed);
+    latencyLastMs.store(0, std::memory_order_relaxed);
+    latencyMaxMs.store(0, std::memory_order_relaxed);
+    latencySumMs.store(0, std::memory_order_relaxed);
+    latencySamples.store(0, std::memory_order_relaxed);
+}
+
+size_t LiveFrameBuffer::queued() const
+{
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+}
+
+void LiveFrameBuffer::moveDue(int32_t deltaMs16)
+{
+    const int32_t total   = static_cast<int32_t>(dueFractionMs16) + deltaMs16;
+    const int32_t wholeMs = (total >= 0) ? total / 16 : -((15 - total) / 16); // floor
+    dueMs          += static_cast<uint32_t>(wholeMs);
+    dueFractionMs16 = static_cast<uint32_t>(total - wholeMs * 16);
+}
+
+void LiveFrameBuffer::recordLatency(uint32_t latencyMs)
+{
+    latencyLastMs.store(latencyMs, std::memory_order_relaxed);
+    if (latencyMs > latencyMaxMs.load(std::memory_order_relaxed))
+    {
+        latencyMaxMs.store(latencyMs, std::memory_order_relaxed);
+    }
+    latencySumMs.fetch_add(latencyMs, std::memory_order_relaxed);
+    latencySamples.fetch_add(1, std::memory_order_relaxed);
+}
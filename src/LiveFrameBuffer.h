@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <array>
+#include <atomic>
+
+#include "config.h"
+#include "Image.h"
+#include "Matrix16x16.h"
+
+// Jitter buffer for frames streamed in from the network (DisplayMode::Live).
+//
+// A lock-free single-producer/single-consumer ring: the receiver push()es
+// frames of Image::kTotalBytes as they arrive, the render loop takes them out
+// with render(). Frames are played out on a clock that steps by the measured
+// arrival interval, so network jitter does not reach the panel. Playback
+// starts LIVE_JITTER_DELAY_MS after the first frame of a burst arrived, and
+// every shown frame pulls the clock towards its own arrival + delay, so the
+// sender's and our millis() may drift apart without the buffer running dry
+// or filling up. The clock keeps 1/16 ms: a 60 fps stream is 16.67 ms per
+// frame, and whole milliseconds would drift by a frame every 25.
+//
+// At most LIVE_JITTER_TARGET_FRAMES stay queued behind the shown frame (older
+// ones are skipped), which bounds the added latency. A full ring drops the
+// new frame; an empty one at a playout step ends the burst until the next
+// frame arrives.
+class LiveFrameBuffer
+{
+public:
+    static constexpr size_t kCapacity = LIVE_FRAME_BUFFER_CAPACITY;
+
+    // producer side; false if `length` is not one frame or the ring is full
+    bool push(const uint8_t* bytes, size_t length, uint32_t nowMs);
+
+    // consumer side, same contract as the animators: copy the frame due at
+    // `nowMs` into `target` and return true, or leave it untouched
+    bool render(Matrix16x16& target, uint32_t nowMs);
+    bool nextChangeTimestamp(uint32_t nowMs, uint32_t& timestampMs) const;
+    bool isPlaying() const;
+
+    // counters, readable from any task
+    uint32_t received() const          { return receivedFrames.load(std::memory_order_relaxed); }
+    uint32_t shown() const             { return shownFrames.load(std::memory_order_relaxed); }
+    uint32_t droppedFull() const       { return fullDrops.load(std::memory_order_relaxed); }
+    uint32_t skipped() const           { return skippedFrames.load(std::memory_order_relaxed); }
+    uint32_t invalid() const           { return invalidFrames.load(std::memory_order_relaxed); }
+    uint32_t underruns() const         { return underrunCount.load(std::memory_order_relaxed); }
+    uint32_t frameIntervalMs() const   { return intervalMs16.load(std::memory_order_relaxed) / 16u; }
+
+    // arrival-to-display latency of the shown frames
+    uint32_t lastLatencyMs() const     { return latencyLastMs.load(std::memory_order_relaxed); }
+    uint32_t maxLatencyMs() const      { return latencyMaxMs.load(std::memory_order_relaxed); }
+    uint32_t averageLatencyMs() const;
+
+    void resetStats();
+
+private:
+    struct Slot
+    {
+        std::array<uint8_t, Image::kTotalBytes> bytes{};
+        uint32_t                                arrivalMs = 0;
+    };
+
+    size_t queued() const;
+    void   moveDue(int32_t deltaMs16);
+    void   recordLatency(uint32_t latencyMs);
+
+    std::array<Slot, kCapacity> slots{};
+    std::atomic<uint32_t>       head{0}; // next slot to write, producer-owned
+    std::atomic<uint32_t>       tail{0}; // next slot to read, consumer-owned
+
+    // producer: arrival interval estimate in 1/16 ms
+    uint32_t              lastArrivalMs  = 0;
+    bool                  hasArrival     = false;
+    std::atomic<uint32_t> intervalMs16{LIVE_DEFAULT_FRAME_INTERVAL_MS * 16u};
+
+    // consumer: due time of the next playout step, dueMs + dueFractionMs16 / 16
+    uint32_t dueMs           = 0;
+    uint32_t dueFractionMs16 = 0;
+    bool     playing         = false;
+
+    std::atomic<uint32_t> receivedFrames{0};
+    std::atomic<uint32_t> shownFrames{0};
+    std::atomic<uint32_t> fullDrops{0};
+    std::atomic<uint32_t> skippedFrames{0};
+    std::atomic<uint32_t> invalidFrames{0};
+    std::atomic<uint32_t> underrunCount{0};
+    std::atomic<uint32_t> latencyLastMs{0};
+    std::atomic<uint32_t> latencyMaxMs{0};
+    std::atomic<uint32_t> latencySumMs{0};
+    std::atomic<uint32_t> latencySamples{0};
+};
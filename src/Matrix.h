@@ -0,0 +1,228 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <type_traits>
+
+#include "BitStorage.h"
+
+// How blit() combines source pixels with the destination.
+enum class BlitOp : uint8_t
+{
+    Copy,   // covered area takes the source pixels
+    Or,
+    And,    // only pixels inside the covered area are affected
+    Xor,
+    AndNot  // clear destination pixels that are set in the source
+};
+
+// W x H monochrome framebuffer, one bit per pixel.
+// Rows are stored in the smallest type that fits W bits (see BitStorage), with
+// x = 0 in the most significant used bit. composeRowWord() builds the word for
+// the shift register chain: the row-select bits above the W column bits, both
+// active-low. WordBits is the length of the shift register chain and defaults
+// to the smallest width holding W + H bits. Everything is resolved at compile
+// time, so a 16x16 panel works on plain uint16_t rows and a 32-bit chain word.
+template <int W, int H, int WordBits = ((W + H > 32) ? (W + H) : 32)>
+class Matrix
+{
+    static_assert(W + H <= WordBits, "every column and row line needs a shift register output");
+
+public:
+    static constexpr int kWidth  = W;
+    static constexpr int kHeight = H;
+
+    using Row     = BitStorage<W>;
+    using RowMask = BitStorage<H>;
+    using Word    = BitStorage<WordBits>;
+
+    void clear()
+    {
+        rows.fill(Row{});
+    }
+
+    void setAll(bool on)
+    {
+        rows.fill(on ? usedBits() : Row{});
+    }
+
+    void setPixel(int x, int y, bool on = true)
+    {
+        if (x < 0 || x >= W || y < 0 || y >= H)
+            return;
+
+        const Row columnMask = getPixelColumnMask(x);
+
+        if (on) rows[y] |= columnMask;
+        else    rows[y] &= static_cast<Row>(~columnMask);
+    }
+
+    bool getPixel(int x, int y) const
+    {
+        if (x < 0 || x >= W || y < 0 || y >= H)
+            return false;
+
+        return bitops::test(rows[y], W - x - 1);
+    }
+
+    Row getPixelColumnMask(int x) const
+    {
+        if (x < 0 || x >= W)
+            return Row{};
+
+        return bitops::bit<Row>(W - x - 1);
+    }
+
+    RowMask getPixelRowMask(int y) const
+    {
+        if (y < 0 || y >= H)
+            return RowMask{};
+
+        return bitops::bit<RowMask>(H - y - 1);
+    }
+
+    void setRowBits(int y, const Row& bits)
+    {
+        if (y < 0 || y >= H)
+            return;
+
+        rows[y] = bits & usedBits();
+    }
+
+    Row getRowBits(int y) const
+    {
+        if (y < 0 || y >= H)
+            return Row{};
+
+        return rows[y];
+    }
+
+    Word composeRowWord(int row) const
+    {
+        if (row < 0 || row >= H)
+            return Word{};
+
+        Word rowWord = bitops::widen<Word>(rows[row]);
+        rowWord |= bitops::bit<Word>(W + H - row - 1);
+
+        // Matrix wiring is active-low for both rows and columns
+        return static_cast<Word>(~rowWord);
+    }
+
+    // Combine a `width` x `height` bitmap into this matrix with its top-left
+    // corner at (destX, destY), clipped to the matrix. Source rows use the same
+    // layout as Matrix rows: pixel x of a row is bit (width - 1 - x). Integer
+    // rows are combined a whole row at a time with one shift and mask.
+    template <typename SourceRow>
+    void blit(const SourceRow* sourceRows, int width, int height, int destX, int destY, BlitOp op = BlitOp::Or)
+    {
+        static_assert(std::is_unsigned<SourceRow>::value && sizeof(SourceRow) <= sizeof(uint64_t),
+                      "blit sources are rows of unsigned integers up to 64 bits");
+
+        if (width <= 0 || width > static_cast<int>(sizeof(SourceRow) * 8))
+            return;
+
+        const int firstRow = (destY < 0) ? -destY : 0;
+        const int lastRow  = (destY + height > H) ? (H - destY) : height;
+
+        if constexpr (!bitops::IsWide<Row>::value)
+        {
+            // source bit b lands on matrix bit b + shift
+            const int      shift     = W - width - destX;
+            const uint64_t sourceMax = (width >= 64) ? ~uint64_t{0} : ((uint64_t{1} << width) - 1u);
+            const Row      covered   = static_cast<Row>(shifted(sourceMax, shift)) & usedBits();
+
+            for (int row = firstRow; row < lastRow; ++row)
+            {
+                const Row bits = static_cast<Row>(shifted(static_cast<uint64_t>(sourceRows[row]) & sourceMax, shift)) & covered;
+                combine(rows[destY + row], bits, covered, op);
+            }
+        }
+        else
+        {
+            for (int row = firstRow; row < lastRow; ++row)
+            {
+                Row bits{};
+                Row covered{};
+                for (int x = 0; x < width; ++x)
+                {
+                    const int destColumn = destX + x;
+                    if (destColumn < 0 || destColumn >= W)
+                        continue;
+
+                    covered |= getPixelColumnMask(destColumn);
+                    if ((static_cast<uint64_t>(sourceRows[row]) >> (width - 1 - x)) & 0x1u)
+                        bits |= getPixelColumnMask(destColumn);
+                }
+                combine(rows[destY + row], bits, covered, op);
+            }
+        }
+    }
+
+    // Same as above with another matrix of the same size as the source.
+    void blit(const Matrix& source, int destX, int destY, BlitOp op = BlitOp::Or)
+    {
+        if constexpr (!bitops::IsWide<Row>::value)
+        {
+            blit(source.rows.data(), W, H, destX, destY, op);
+        }
+        else
+        {
+            for (int y = 0; y < H; ++y)
+            {
+                for (int x = 0; x < W; ++x)
+                {
+                    const int destColumn = destX + x;
+                    const int destRow    = destY + y;
+                    if (destColumn < 0 || destColumn >= W || destRow < 0 || destRow >= H)
+                        continue;
+
+                    const Row mask = getPixelColumnMask(destColumn);
+                    const Row bits = source.getPixel(x, y) ? mask : Row{};
+                    combine(rows[destRow], bits, mask, op);
+                }
+            }
+        }
+    }
+
+    void copyFrom(const Matrix& other)
+    {
+        rows = other.rows;
+    }
+
+    void merge(const Matrix& other)
+    {
+        for (int i = 0; i < H; ++i)
+        {
+            rows[i] |= other.rows[i];
+        }
+    }
+
+private:
+    static Row usedBits()
+    {
+        return bitops::lowMask<Row>(W);
+    }
+
+    static uint64_t shifted(uint64_t value, int shift)
+    {
+        if (shift >= 64 || shift <= -64)
+            return 0u;
+        return (shift >= 0) ? (value << shift) : (value >> -shift);
+    }
+
+    // `bits` must lie within `covered`
+    static void combine(Row& target, const Row& bits, const Row& covered, BlitOp op)
+    {
+        switch (op)
+        {
+            case BlitOp::Copy:   target = (target & static_cast<Row>(~covered)) | bits; break;
+            case BlitOp::Or:     target |= bits;                                      break;
+            case BlitOp::And:    target &= static_cast<Row>(bits | ~covered);         break;
+            case BlitOp::Xor:    target ^= bits;                                      break;
+            case BlitOp::AndNot: target &= static_cast<Row>(~bits);                   break;
+        }
+    }
+
+    std::array<Row, H> rows{};
+};
@@ -1,28 +1,8 @@
 ﻿#pragma once
 
-#include <stdint.h>
-#include <array>
+#include "Matrix.h"
 
-class Matrix16x16
-{
-public:
-    void clear();
-    void setAll(bool on);
-
-    void setPixel(int x, int y, bool on = true);
-    bool getPixel(int x, int y) const;
-
-    uint16_t getPixelColumnMask(int x) const;
-    uint16_t getPixelRowMask(int y) const;
-
-    void     setRowBits(int y, uint16_t bits);
-    uint16_t getRowBits(int y) const;
-
-    uint32_t composeRowWord(int row) const;
-
-    void copyFrom(const Matrix16x16& other);
-    void merge(const Matrix16x16& other);
-
-private:
-    std::array<uint16_t, LED_MATRIX_ROWS> rows{};
-};
+// Framebuffer for the configured panel. The name predates the Matrix template
+// and is kept for the existing call sites; the size follows LED_MATRIX_COLS/ROWS
+// and the row word spans the SR_CHAIN_CHIPS 8-bit shift registers.
+using Matrix16x16 = Matrix<LED_MATRIX_COLS, LED_MATRIX_ROWS, SR_CHAIN_CHIPS * 8>;
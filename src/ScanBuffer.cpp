@@ -0,0 +1,260 @@
+#include "ScanBuffer.h"
+
+#include <algorithm>
+
+ScanBuffer::ScanBuffer()
+{
+    clear();
+}
+
+void ScanBuffer::build(const Matrix16x16& matrix)
+{
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        words[0][row]    = matrix.composeRowWord(row);
+        rowLoads[0][row] = static_cast<uint8_t>(bitops::popcount(matrix.getRowBits(row)));
+    }
+
+    planeCount = 1;
+    updateActiveRows();
+    updateTimings();
+}
+
+void ScanBuffer::build(const GrayscaleMatrix& matrix)
+{
+    planeCount = matrix.getBitDepth();
+
+    for (int plane = 0; plane < planeCount; ++plane)
+    {
+        for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+        {
+            words[plane][row]    = matrix.composeRowWord(plane, row);
+            rowLoads[plane][row] = static_cast<uint8_t>(bitops::popcount(matrix.getPlaneRowBits(plane, row)));
+        }
+    }
+
+    updateActiveRows();
+    updateTimings();
+}
+
+void ScanBuffer::clear()
+{
+    for (auto& plane : words)
+    {
+        plane.fill(kBlankWord);
+    }
+    for (auto& plane : rowLoads)
+    {
+        plane.fill(0);
+    }
+    updateActiveRows();
+    updateTimings();
+}
+
+void ScanBuffer::setTiming(uint32_t newRowPeriodUs, uint32_t newBrightnessDuty, uint32_t newBrightnessScale)
+{
+    periodUs        = newRowPeriodUs;
+    brightnessDuty  = newBrightnessDuty;
+    brightnessScale = newBrightnessScale;
+    updateTimings();
+}
+
+void ScanBuffer::setSchedule(ScanSchedule newSchedule)
+{
+    if (schedule == newSchedule)
+        return;
+
+    schedule = newSchedule;
+    updateActiveRows();
+    updateTimings();
+}
+
+ScanSchedule ScanBuffer::getSchedule() const
+{
+    return schedule;
+}
+
+void ScanBuffer::setRowLoadCompensation(bool enable)
+{
+    if (rowLoadCompensation == enable)
+        return;
+
+    rowLoadCompensation = enable;
+    updateTimings();
+}
+
+bool ScanBuffer::isRowLoadCompensationEnabled() const
+{
+    return rowLoadCompensation;
+}
+
+void ScanBuffer::setRowLoadCurve(const RowLoadCurve& curve)
+{
+    rowLoadCurve = curve;
+    updateTimings();
+}
+
+const ScanBuffer::RowLoadCurve& ScanBuffer::getRowLoadCurve() const
+{
+    return rowLoadCurve;
+}
+
+ScanBuffer::RowLoadCurve ScanBuffer::defaultRowLoadCurve()
+{
+    // linear from ROW_LOAD_SPARSE_GAIN for a single LED up to unity for a full row
+    RowLoadCurve curve{};
+    curve[0] = kUnityGain;
+    for (int lit = 1; lit <= LED_MATRIX_COLS; ++lit)
+    {
+        const int span = (LED_MATRIX_COLS > 1) ? (LED_MATRIX_COLS - 1) : 1;
+        curve[lit] = static_cast<uint16_t>(ROW_LOAD_SPARSE_GAIN + ((kUnityGain - ROW_LOAD_SPARSE_GAIN) * (lit - 1)) / span);
+    }
+    return curve;
+}
+
+void ScanBuffer::updateActiveRows()
+{
+    activeRowCount = 0;
+
+    if (schedule != ScanSchedule::AllRows)
+    {
+        for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+        {
+            for (int plane = 0; plane < planeCount; ++plane)
+            {
+                if (rowLoads[plane][row] != 0)
+                {
+                    activeRows[activeRowCount++] = static_cast<uint8_t>(row);
+                    break;
+                }
+            }
+        }
+    }
+
+    // all rows scheduled, or nothing lit: keep scanning the full (blank) frame
+    if (activeRowCount == 0)
+    {
+        for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+        {
+            activeRows[row] = static_cast<uint8_t>(row);
+        }
+        activeRowCount = LED_MATRIX_ROWS;
+    }
+}
+
+void ScanBuffer::updateTimings()
+{
+    // the shared-period schedule hands the time of skipped rows to the remaining ones
+    rowPeriodUs = periodUs;
+    if (schedule == ScanSchedule::ActiveRowsSharedPeriod)
+    {
+        rowPeriodUs = (periodUs * LED_MATRIX_ROWS) / activeRowCount;
+    }
+
+    uint32_t litTimeUs = 0;
+    if (brightnessScale == 0 || brightnessDuty == 0)
+    {
+        // zero brightness
+        litTimeUs = 0;
+    }
+    else if (brightnessDuty >= brightnessScale)
+    {
+        // full brightness
+        litTimeUs = rowPeriodUs;
+    }
+    else
+    {
+        litTimeUs = static_cast<uint32_t>((static_cast<uint64_t>(rowPeriodUs) * brightnessDuty) / brightnessScale);
+    }
+
+    // protect the LEDs when only a few rows share the frame
+    const uint32_t maxRowOnTimeUs = (periodUs * LED_MATRIX_ROWS * SCAN_MAX_ROW_DUTY_PERCENT) / 100u;
+    if (litTimeUs > maxRowOnTimeUs)
+        litTimeUs = maxRowOnTimeUs;
+    if (litTimeUs > rowPeriodUs)
+        litTimeUs = rowPeriodUs;
+
+    // every phase has to outlast the word transfer that starts it: drop LSB planes
+    // until the shortest remaining one does (the MSB plane alone is stretched below)
+    droppedPlanes = 0;
+    while (planeCount - droppedPlanes > 1)
+    {
+        const uint32_t units = (1u << (planeCount - droppedPlanes)) - 1u;
+        if ((litTimeUs + units / 2u) / units >= SCAN_MIN_PHASE_US)
+            break;
+        ++droppedPlanes;
+    }
+
+    // nominal on-time per plane; BCM splits the lit time into (2^n - 1) units, plane k gets 2^k of them,
+    // each rounded on its own so the planes add up to the lit time instead of losing the remainder
+    std::array<uint32_t, kMaxPlanes> nominalUs{};
+    const uint32_t                   units = (1u << (planeCount - droppedPlanes)) - 1u;
+    for (int plane = droppedPlanes; plane < planeCount; ++plane)
+    {
+        nominalUs[plane] = (litTimeUs * (1u << (plane - droppedPlanes)) + units / 2u) / units;
+    }
+
+    std::array<uint32_t, LED_MATRIX_ROWS> rowOnUs{};
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        uint32_t usedUs = 0;
+        for (int plane = 0; plane < planeCount; ++plane)
+        {
+            uint32_t onTimeUs = nominalUs[plane];
+            if (rowLoadCompensation)
+            {
+                onTimeUs = (onTimeUs * rowLoadCurve[rowLoads[plane][row]]) / kUnityGain;
+            }
+            onTimesUs[plane][row] = onTimeUs;
+            usedUs += onTimeUs;
+        }
+
+        // gains above unity may not stretch a row beyond its period or duty limit
+        const uint32_t rowLimitUs = (schedule == ScanSchedule::AllRows) ? rowPeriodUs : std::min(rowPeriodUs, maxRowOnTimeUs);
+        if (usedUs > rowLimitUs)
+        {
+            uint32_t scaledUs = 0;
+            for (int plane = 0; plane < planeCount; ++plane)
+            {
+                onTimesUs[plane][row] = static_cast<uint32_t>((static_cast<uint64_t>(onTimesUs[plane][row]) * rowLimitUs) / usedUs);
+                scaledUs += onTimesUs[plane][row];
+            }
+            usedUs = scaledUs;
+        }
+
+        // gains below unity and the scaling above may not undercut the word transfer either
+        usedUs = 0;
+        for (int plane = 0; plane < planeCount; ++plane)
+        {
+            if (onTimesUs[plane][row] != 0 && onTimesUs[plane][row] < SCAN_MIN_PHASE_US)
+                onTimesUs[plane][row] = SCAN_MIN_PHASE_US;
+            usedUs += onTimesUs[plane][row];
+        }
+
+        rowOnUs[row]    = usedUs;
+        offTimesUs[row] = (usedUs < rowPeriodUs) ? (rowPeriodUs - usedUs) : 0;
+    }
+
+    // the fast refresh ends the frame after the active rows, so the limit has to hold
+    // for that shorter frame: stretch it with off-time spread over the active rows
+    uint32_t longestOnUs = 0;
+    frameUs = 0;
+    for (int index = 0; index < activeRowCount; ++index)
+    {
+        const int row = activeRows[index];
+        longestOnUs = std::max(longestOnUs, rowOnUs[row]);
+        frameUs += rowOnUs[row] + offTimesUs[row];
+    }
+
+    const uint32_t minFrameUs = (longestOnUs * 100u + SCAN_MAX_ROW_DUTY_PERCENT - 1u) / SCAN_MAX_ROW_DUTY_PERCENT;
+    if (minFrameUs > frameUs)
+    {
+        const uint32_t paddingUs = minFrameUs - frameUs;
+        for (int index = 0; index < activeRowCount; ++index)
+        {
+            offTimesUs[activeRows[index]] += paddingUs / activeRowCount;
+        }
+        offTimesUs[activeRows[0]] += paddingUs % activeRowCount;
+        frameUs = minFrameUs;
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+
+#include "config.h"
+#include "Matrix16x16.h"
+#include "GrayscaleMatrix.h"
+
+// Per-frame table of shift words, one per matrix row and bit plane.
+// Built once whenever a new frame is picked up so the scan loop only has to
+// index an array; each entry is exactly what ShiftRegisterChain::writeWord expects.
+// ScanEngine walks the table row by row.
+//
+// A Matrix16x16 frame yields a single plane. A GrayscaleMatrix frame yields one
+// plane per bit and is scanned with Binary Code Modulation: plane k stays lit
+// for 2^k time units within the row period. No lit phase is planned shorter than
+// SCAN_MIN_PHASE_US; when the lit time is too short for all planes the lowest
+// ones are dropped, so dim settings lose grey levels rather than going dark.
+//
+// On-times are stored per plane and row. With row load compensation enabled the
+// nominal on-time of every row word is scaled by a gain looked up from the number
+// of lit LEDs in it, because rows sharing the column drivers get dimmer the more
+// LEDs they light.
+//
+// The schedule decides which rows are visited: every row, or only rows with at
+// least one lit LED. Skipping blank rows either spreads the unchanged frame
+// period over the remaining rows (brighter) or keeps the row period and ends the
+// frame early (faster refresh). Either way a single row is never lit for more
+// than SCAN_MAX_ROW_DUTY_PERCENT of the frame it is scanned in: the shared period
+// cuts the on-time, the fast refresh pads a short frame with off-time.
+enum class ScanSchedule : uint8_t
+{
+    AllRows,
+    ActiveRowsSharedPeriod,
+    ActiveRowsFastRefresh
+};
+
+class ScanBuffer
+{
+public:
+    using Word = Matrix16x16::Word;
+
+    static constexpr Word     kBlankWord = static_cast<Word>(~Word{}); // all rows and columns released (active-low)
+    static constexpr int      kMaxPlanes = GrayscaleMatrix::kMaxBitDepth;
+    static constexpr uint16_t kUnityGain = 256;
+
+    // on-time gain (x/256) indexed by the number of lit LEDs in a row word
+    using RowLoadCurve = std::array<uint16_t, LED_MATRIX_COLS + 1>;
+
+    ScanBuffer();
+
+    void build(const Matrix16x16& matrix);
+    void build(const GrayscaleMatrix& matrix);
+    void clear();
+
+    void setTiming(uint32_t rowPeriodUs, uint32_t brightnessDuty, uint32_t brightnessScale);
+
+    void         setSchedule(ScanSchedule newSchedule);
+    ScanSchedule getSchedule() const;
+
+    void                setRowLoadCompensation(bool enable);
+    bool                isRowLoadCompensationEnabled() const;
+    void                setRowLoadCurve(const RowLoadCurve& curve);
+    const RowLoadCurve& getRowLoadCurve() const;
+    static RowLoadCurve defaultRowLoadCurve();
+
+    int      getPlaneCount() const                   { return planeCount; }
+    int      droppedPlaneCount() const               { return droppedPlanes; }
+    int      scanRowCount() const                    { return activeRowCount; }
+    int      scanRowAt(int index) const              { return activeRows[index]; }
+    uint32_t effectiveRowPeriodUs() const            { return rowPeriodUs; }
+    uint32_t framePeriodUs() const                   { return frameUs; }
+    uint32_t planeOnTimeUs(int plane, int row) const { return onTimesUs[plane][row]; }
+    uint32_t rowOffTimeUs(int row) const             { return offTimesUs[row]; }
+    uint8_t  rowLoad(int plane, int row) const       { return rowLoads[plane][row]; }
+
+    const Word& rowWord(int row) const              { return words[0][row]; }
+    const Word& planeWord(int plane, int row) const { return words[plane][row]; }
+    const Word* rowWords() const                    { return words[0].data(); }
+
+private:
+    void updateActiveRows();
+    void updateTimings();
+
+    template <typename T>
+    using PlaneTable = std::array<std::array<T, LED_MATRIX_ROWS>, kMaxPlanes>;
+
+    PlaneTable<Word>                      words{};
+    PlaneTable<uint8_t>                   rowLoads{};
+    PlaneTable<uint32_t>                  onTimesUs{};
+    std::array<uint32_t, LED_MATRIX_ROWS> offTimesUs{};
+
+    std::array<uint8_t, LED_MATRIX_ROWS>  activeRows{};
+
+    int          planeCount          = 1;
+    int          droppedPlanes       = 0; // LSB planes left dark because their unit would undercut SCAN_MIN_PHASE_US
+    int          activeRowCount      = LED_MATRIX_ROWS;
+    uint32_t     periodUs            = 0;
+    uint32_t     rowPeriodUs         = 0;
+    uint32_t     frameUs             = 0; // sum of on- and off-times of the scheduled rows
+    uint32_t     brightnessDuty      = 0;
+    uint32_t     brightnessScale     = 0;
+    ScanSchedule schedule            = ScanSchedule::AllRows;
+    bool         rowLoadCompensation = ROW_LOAD_COMPENSATION_ENABLED;
+    RowLoadCurve rowLoadCurve        = defaultRowLoadCurve();
+};
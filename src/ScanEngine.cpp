@@ -0,0 +1,73 @@
+#include "ScanEngine.h"
+
+ScanBuffer& ScanEngine::backBuffer()
+{
+    return buffers[activeIndex.load(std::memory_order_acquire) ^ 1u];
+}
+
+bool ScanEngine::hasPendingFrame() const
+{
+    return framePending.load(std::memory_order_acquire);
+}
+
+void ScanEngine::queueFrame()
+{
+    framePending.store(true, std::memory_order_release);
+}
+
+ScanEngine::Step ScanEngine::step()
+{
+    Step result;
+
+    // one full frame worth of phases; bail out with a blank word if all of them are empty
+    constexpr int kMaxPhasesPerFrame = LED_MATRIX_ROWS * (ScanBuffer::kMaxPlanes + 1);
+
+    for (int guard = 0; guard <= kMaxPhasesPerFrame; ++guard)
+    {
+        if (slot == 0 && phase == 0)
+        {
+            if (framePending.load(std::memory_order_acquire))
+            {
+                activeIndex.store(activeIndex.load(std::memory_order_relaxed) ^ 1u, std::memory_order_release);
+                framePending.store(false, std::memory_order_release);
+            }
+            result.frameStart = true;
+        }
+
+        if (phase == 0)
+        {
+            result.rowStart = true;
+        }
+
+        const ScanBuffer& buffer = buffers[activeIndex.load(std::memory_order_relaxed)];
+        const int         planes = buffer.getPlaneCount();
+
+        const int row = buffer.scanRowAt(slot);
+
+        ScanBuffer::Word word;
+        uint32_t         durationUs;
+        if (phase < planes)
+        {
+            word       = buffer.planeWord(phase, row);
+            durationUs = buffer.planeOnTimeUs(phase, row);
+            ++phase;
+        }
+        else
+        {
+            word       = ScanBuffer::kBlankWord;
+            durationUs = buffer.rowOffTimeUs(row);
+            phase      = 0;
+            slot       = (slot + 1) % buffer.scanRowCount();
+        }
+
+        if (durationUs > 0)
+        {
+            result.word       = word;
+            result.durationUs = durationUs;
+            result.row        = row;
+            return result;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <atomic>
+
+#include "config.h"
+#include "ScanBuffer.h"
+
+// Row/phase state machine driven by the scan timer interrupt.
+// Every call to step() yields the next precomputed word to latch and how long
+// it must stay on the outputs. Each row runs through its bit planes followed by
+// a blank phase; phases with zero duration are skipped. Rows are visited in the
+// order of the active buffer's schedule, so skipped blank rows cost no time.
+//
+// Frames are double buffered: the display task fills backBuffer() and calls
+// queueFrame(); the engine adopts it when the next frame starts and reports
+// that boundary through Step::frameStart. No platform dependencies so it can be
+// stepped from native tests.
+class ScanEngine
+{
+public:
+    struct Step
+    {
+        ScanBuffer::Word word       = ScanBuffer::kBlankWord;
+        uint32_t         durationUs = 0; // zero only if the active frame has nothing to scan
+        int              row        = 0;
+        bool             rowStart   = false; // first non-empty phase of a row
+        bool             frameStart = false;
+    };
+
+    ScanBuffer& backBuffer();
+    bool        hasPendingFrame() const;
+    void        queueFrame();
+
+    Step step();
+
+private:
+    std::array<ScanBuffer, 2> buffers;
+    std::atomic<uint8_t>      activeIndex{0};
+    std::atomic<bool>         framePending{false};
+
+    int slot  = 0; // index into the active buffer's schedule
+    int phase = 0;
+};
@@ -0,0 +1,118 @@
+#include "ScanStats.h"
+
+JitterHistogram::JitterHistogram()
+{
+    reset();
+}
+
+int JitterHistogram::bucketIndex(int32_t deviationUs)
+{
+    // floor division so that small negative deviations land below zero
+    const int32_t offset = (deviationUs >= 0) ? (deviationUs / kBucketWidthUs)
+                                              : -((-deviationUs + kBucketWidthUs - 1) / kBucketWidthUs);
+    int index = offset + kBucketCount / 2;
+    if (index < 0)
+        index = 0;
+    if (index >= kBucketCount)
+        index = kBucketCount - 1;
+    return index;
+}
+
+void JitterHistogram::record(int32_t deviationUs)
+{
+    buckets[bucketIndex(deviationUs)].fetch_add(1, std::memory_order_relaxed);
+
+    // single writer: plain load/store is enough for the extremes
+    const uint32_t previous = samples.load(std::memory_order_relaxed);
+    if (previous == 0 || deviationUs < minDeviationUs.load(std::memory_order_relaxed))
+        minDeviationUs.store(deviationUs, std::memory_order_relaxed);
+    if (previous == 0 || deviationUs > maxDeviationUs.load(std::memory_order_relaxed))
+        maxDeviationUs.store(deviationUs, std::memory_order_relaxed);
+    samples.fetch_add(1, std::memory_order_relaxed);
+}
+
+void JitterHistogram::reset()
+{
+    for (auto& bucket : buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    samples.store(0, std::memory_order_relaxed);
+    minDeviationUs.store(0, std::memory_order_relaxed);
+    maxDeviationUs.store(0, std::memory_order_relaxed);
+}
+
+void ScanStats::recordStep(uint32_t nowUs, uint32_t durationUs, bool rowStart, bool frameStart)
+{
+#if SCAN_STATS_ENABLED
+    // a requested reset drops the frame that just ended and starts measuring afresh
+    if (frameStart && resetRequested.load(std::memory_order_acquire))
+    {
+        reset();
+        rowOpen   = false;
+        frameOpen = false;
+        resetRequested.store(false, std::memory_order_release);
+    }
+
+    // periods are measured between consecutive starts; unsigned differences survive timer wrap
+    if (rowStart)
+    {
+        if (rowOpen)
+        {
+            const uint32_t actualUs = nowUs - rowStartUs;
+            rowHistogram.record(static_cast<int32_t>(actualUs - rowScheduledUs));
+        }
+        rowStartUs     = nowUs;
+        rowScheduledUs = 0;
+        rowOpen        = true;
+    }
+
+    if (frameStart)
+    {
+        if (frameOpen)
+        {
+            const uint32_t actualUs = nowUs - frameStartUs;
+            frameHistogram.record(static_cast<int32_t>(actualUs - frameScheduledUs));
+
+            if (minFrameUs.load(std::memory_order_relaxed) == 0 || actualUs < minFrameUs.load(std::memory_order_relaxed))
+                minFrameUs.store(actualUs, std::memory_order_relaxed);
+            if (actualUs > maxFrameUs.load(std::memory_order_relaxed))
+                maxFrameUs.store(actualUs, std::memory_order_relaxed);
+            lastFrameUs.store(actualUs, std::memory_order_relaxed);
+        }
+        frameStartUs     = nowUs;
+        frameScheduledUs = 0;
+        frameOpen        = true;
+    }
+
+    rowScheduledUs   += durationUs;
+    frameScheduledUs += durationUs;
+#else
+    (void)nowUs;
+    (void)durationUs;
+    (void)rowStart;
+    (void)frameStart;
+#endif
+}
+
+void ScanStats::recordDeadlineMiss()
+{
+#if SCAN_STATS_ENABLED
+    missedDeadlines.fetch_add(1, std::memory_order_relaxed);
+#endif
+}
+
+void ScanStats::requestReset()
+{
+    resetRequested.store(true, std::memory_order_release);
+}
+
+void ScanStats::reset()
+{
+    rowHistogram.reset();
+    frameHistogram.reset();
+    missedDeadlines.store(0, std::memory_order_relaxed);
+    lastFrameUs.store(0, std::memory_order_relaxed);
+    minFrameUs.store(0, std::memory_order_relaxed);
+    maxFrameUs.store(0, std::memory_order_relaxed);
+}
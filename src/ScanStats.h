@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stdint.h>
+#include <array>
+#include <atomic>
+
+#include "config.h"
+
+// Fixed-size histogram of timing deviations in microseconds.
+// Bucket i collects deviations in [lowerBoundUs(i), lowerBoundUs(i) + kBucketWidthUs);
+// the first and last bucket also take everything beyond the covered range.
+// Written by a single producer (the scan ISR) with relaxed atomics only, so
+// recording costs a few instructions and never blocks; readers may observe a
+// sample in the bucket before it shows up in count().
+class JitterHistogram
+{
+public:
+    static constexpr int     kBucketCount   = 16;
+    static constexpr int32_t kBucketWidthUs = 8;
+
+    JitterHistogram();
+
+    void record(int32_t deviationUs);
+    void reset();
+
+    uint32_t count() const                      { return samples.load(std::memory_order_relaxed); }
+    uint32_t bucket(int index) const            { return buckets[index].load(std::memory_order_relaxed); }
+    int32_t  minUs() const                      { return minDeviationUs.load(std::memory_order_relaxed); }
+    int32_t  maxUs() const                      { return maxDeviationUs.load(std::memory_order_relaxed); }
+
+    static constexpr int32_t lowerBoundUs(int index)
+    {
+        return (index - kBucketCount / 2) * kBucketWidthUs;
+    }
+
+    static int bucketIndex(int32_t deviationUs);
+
+private:
+    std::array<std::atomic<uint32_t>, kBucketCount> buckets;
+    std::atomic<uint32_t>                           samples{0};
+    std::atomic<int32_t>                            minDeviationUs{0};
+    std::atomic<int32_t>                            maxDeviationUs{0};
+};
+
+// Scan-out timing statistics: how far every row and every frame deviates from
+// the time the scan engine scheduled for it, plus missed timer deadlines.
+// recordStep() is meant to be called from the scan ISR for every latched word;
+// it derives row and frame periods from the step boundaries itself. Readers on
+// other cores only load the counters; requestReset() asks the ISR to clear them
+// at the next frame start, so the producer stays the only writer. With
+// SCAN_STATS_ENABLED set to 0 all recording compiles to nothing.
+class ScanStats
+{
+public:
+    void recordStep(uint32_t nowUs, uint32_t durationUs, bool rowStart, bool frameStart);
+    void recordDeadlineMiss();
+    void requestReset();
+    bool isResetPending() const                 { return resetRequested.load(std::memory_order_acquire); }
+
+    const JitterHistogram& rowJitter() const    { return rowHistogram; }
+    const JitterHistogram& frameJitter() const  { return frameHistogram; }
+    uint32_t deadlineMisses() const             { return missedDeadlines.load(std::memory_order_relaxed); }
+    uint32_t lastFramePeriodUs() const          { return lastFrameUs.load(std::memory_order_relaxed); }
+    uint32_t minFramePeriodUs() const           { return minFrameUs.load(std::memory_order_relaxed); }
+    uint32_t maxFramePeriodUs() const           { return maxFrameUs.load(std::memory_order_relaxed); }
+
+    static constexpr bool enabled()             { return SCAN_STATS_ENABLED != 0; }
+
+private:
+    void reset();
+
+    JitterHistogram       rowHistogram;
+    JitterHistogram       frameHistogram;
+    std::atomic<uint32_t> missedDeadlines{0};
+    std::atomic<uint32_t> lastFrameUs{0};
+    std::atomic<uint32_t> minFrameUs{0};
+    std::atomic<uint32_t> maxFrameUs{0};
+    std::atomic<bool>     resetRequested{false};
+
+    // producer-only state
+    uint32_t rowStartUs       = 0;
+    uint32_t rowScheduledUs   = 0;
+    uint32_t frameStartUs     = 0;
+    uint32_t frameScheduledUs = 0;
+    bool     rowOpen          = false;
+    bool     frameOpen        = false;
+};
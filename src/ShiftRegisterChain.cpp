@@ -15,7 +15,7 @@ void ShiftRegisterChain::begin()
     gBackend->spi.begin(clockPin, -1, dataPin, -1);
     spiInitialized = true;
 
-    writeWord(~0);
+    writeWord(static_cast<Word>(~Word{}));
     gBackend->gpio.digitalWrite(oePin, LOW);
 }
 
@@ -27,18 +27,37 @@ void ShiftRegisterChain::enableOutput(bool enable)
     gBackend->gpio.digitalWrite(oePin, enable ? LOW : HIGH);
 }
 
-void ShiftRegisterChain::writeWord(uint32_t word)
+void ShiftRegisterChain::writeWord(const Word& word)
 {
     if (gBackend == nullptr || !spiInitialized)
         return;
 
+    // the word is little-endian, so its first bytes are the low bits the chain holds
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&word);
+
     gBackend->gpio.digitalWrite(latchPin, LOW);
-    gBackend->spi.beginTransaction(spiSettings);
-    gBackend->spi.writeBytes(reinterpret_cast<uint8_t*>(&word), sizeof(word));
-    gBackend->spi.endTransaction();
+    if (busClaimed)
+    {
+        gBackend->spi.writeBytes(bytes, kChainBytes);
+    }
+    else
+    {
+        gBackend->spi.beginTransaction(spiSettings);
+        gBackend->spi.writeBytes(bytes, kChainBytes);
+        gBackend->spi.endTransaction();
+    }
     gBackend->gpio.digitalWrite(latchPin, HIGH);
 }
 
+void ShiftRegisterChain::claimBus()
+{
+    if (gBackend == nullptr || !spiInitialized || busClaimed)
+        return;
+
+    gBackend->spi.beginTransaction(spiSettings);
+    busClaimed = true;
+}
+
 int ShiftRegisterChain::getDataPin() const
 {
     return dataPin;
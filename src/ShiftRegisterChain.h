@@ -2,13 +2,22 @@
 
 #include <stdint.h>
 #include "config.h"
+#include "Matrix16x16.h"
 
 class ShiftRegisterChain
 {
 public:
+    // one bit per register output, shifted out LSB first
+    using Word = Matrix16x16::Word;
+    static constexpr int kChainBytes = SR_CHAIN_CHIPS;
+
     void begin();
     void enableOutput(bool enable);
-    void writeWord(uint32_t word);
+    void writeWord(const Word& word);
+
+    // Keep one SPI transaction open for good so writeWord() no longer takes the
+    // SPI locks and may be called from the scan timer ISR.
+    void claimBus();
 
     int getDataPin()  const;
     int getClockPin() const;
@@ -18,6 +27,7 @@ public:
 private:
     SPISettings spiSettings { SHIFTREG_SPI_FREQUENCY_HZ, SPI_LSBFIRST, SPI_MODE0 };
     bool        spiInitialized = false;
+    bool        busClaimed     = false;
 
     int dataPin  = PIN_SR_DATA; 
     int clockPin = PIN_SR_CLK;
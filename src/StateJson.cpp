@@ -0,0 +1,161 @@
+#include "StateJson.h"
+
+#include <stdio.h>
+
+namespace
+{
+constexpr char kHexDigits[] = "0123456789abcdef";
+
+void appendUnsigned(std::string& out, unsigned long value)
+{
+    char buf[12];
+    const int length = snprintf(buf, sizeof(buf), "%lu", value);
+    out.append(buf, static_cast<size_t>(length));
+}
+
+void appendBool(std::string& out, bool value)
+{
+    out += value ? "true" : "false";
+}
+
+void appendLine(std::string& out, const char* name, const StateJson::TextLine& line)
+{
+    out += '"';
+    out += name;
+    out += "\":{\"value\":\"";
+    StateJson::appendEscaped(out, line.value);
+    out += "\",\"animation\":\"";
+    out += line.animation;
+    out += "\",\"frameDuration\":";
+    appendUnsigned(out, line.frameDurationMs);
+    out += '}';
+}
+
+// rows MSB-first, the format /api/images accepts
+void appendHexFrame(std::string& out, const Image& image)
+{
+    for (int row = 0; row < Image::kHeight; ++row)
+    {
+        uint8_t bytes[Image::kRowBytes];
+        image.getRowBytes(row, bytes);
+        for (uint8_t byte : bytes)
+        {
+            out += kHexDigits[byte >> 4];
+            out += kHexDigits[byte & 0x0F];
+        }
+    }
+}
+} // namespace
+
+bool StateJson::isCurrent(uint32_t version) const
+{
+    return valid && cachedVersion == version;
+}
+
+const std::string& StateJson::update(const Snapshot& snapshot)
+{
+    build(snapshot, cached);
+    cachedVersion = snapshot.version;
+    valid         = true;
+    return cached;
+}
+
+const std::string& StateJson::payload() const
+{
+    return cached;
+}
+
+uint32_t StateJson::version() const
+{
+    return cachedVersion;
+}
+
+std::string StateJson::etag(uint32_t version)
+{
+    char buf[12];
+    const int length = snprintf(buf, sizeof(buf), "\"%08lx\"", static_cast<unsigned long>(version));
+    return std::string(buf, static_cast<size_t>(length));
+}
+
+void StateJson::build(const Snapshot& snapshot, std::string& out)
+{
+    out.clear();
+    out.reserve(384 + Image::kTotalBytes * 2 + snapshot.top.value.size() + snapshot.bottom.value.size());
+
+    out += "{\"version\":";
+    appendUnsigned(out, snapshot.version);
+    out += ",\"mode\":\"";
+    out += snapshot.mode;
+    out += "\",";
+
+    out += "\"text\":{\"layout\":\"";
+    out += snapshot.layout;
+    out += "\",\"lines\":{";
+    appendLine(out, "top", snapshot.top);
+    out += ',';
+    appendLine(out, "bottom", snapshot.bottom);
+    out += "}},";
+
+    out += "\"images\":{\"count\":";
+    appendUnsigned(out, snapshot.imageCount);
+    out += ",\"unique\":";
+    appendUnsigned(out, snapshot.imageUnique);
+    out += ",\"encodedBytes\":";
+    appendUnsigned(out, snapshot.imageEncodedBytes);
+    out += ",\"frameDuration\":";
+    appendUnsigned(out, snapshot.imageFrameDurationMs);
+    out += ",\"totalDuration\":";
+    appendUnsigned(out, snapshot.imageTotalDurationMs);
+    out += ",\"loop\":";
+    appendBool(out, snapshot.imageLoop);
+    if (snapshot.hasFirstFrame)
+    {
+        out += ",\"firstFrame\":\"";
+        appendHexFrame(out, snapshot.firstFrame);
+        out += '"';
+    }
+    out += '}';
+
+    out += ",\"brightness\":{\"percent\":";
+    appendUnsigned(out, snapshot.brightnessPercent);
+    out += ",\"duty\":";
+    char duty[16];
+    const int dutyLength = snprintf(duty, sizeof(duty), "%.4f", static_cast<double>(snapshot.brightnessDuty));
+    out.append(duty, static_cast<size_t>(dutyLength));
+    out += ",\"scale\":";
+    appendUnsigned(out, snapshot.brightnessScale);
+    out += '}';
+
+    out += ",\"scan\":{\"schedule\":\"";
+    out += snapshot.scanSchedule;
+    out += "\",\"rowLoadCompensation\":";
+    appendBool(out, snapshot.rowLoadCompensation);
+    out += "}}";
+}
+
+void StateJson::appendEscaped(std::string& out, const std::string& text)
+{
+    for (unsigned char ch : text)
+    {
+        switch (ch)
+        {
+            case '\\': out += "\\\\"; break;
+            case '"':  out += "\\\""; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (ch < 0x20)
+                {
+                    out += "\\u00";
+                    out += kHexDigits[ch >> 4];
+                    out += kHexDigits[ch & 0x0F];
+                }
+                else
+                {
+                    out += static_cast<char>(ch);
+                }
+                break;
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+#include "Image.h"
+
+// The /api/state document, cached per state version.
+//
+// WebInterface bumps its version on every change and fills a Snapshot only
+// when the cached payload is older than that, so polling clients are served
+// the same bytes (or a 304) without rebuilding anything. The builder works on
+// std::string so it is covered by the native tests and benchmark.
+class StateJson
+{
+public:
+    struct TextLine
+    {
+        std::string value;
+        const char* animation       = "hold";
+        uint32_t    frameDurationMs = 0;
+    };
+
+    struct Snapshot
+    {
+        uint32_t    version = 0;
+        const char* mode    = "text";
+
+        const char* layout = "dual";
+        TextLine    top;
+        TextLine    bottom;
+
+        size_t   imageCount           = 0;
+        size_t   imageUnique          = 0;
+        size_t   imageEncodedBytes    = 0;
+        uint32_t imageFrameDurationMs = 0;
+        uint32_t imageTotalDurationMs = 0;
+        bool     imageLoop            = false;
+        bool     hasFirstFrame        = false;
+        Image    firstFrame;
+
+        uint8_t  brightnessPercent = 100;
+        float    brightnessDuty    = 1.0f;
+        uint16_t brightnessScale   = 1;
+
+        const char* scanSchedule        = "all";
+        bool        rowLoadCompensation = false;
+    };
+
+    // true if the cached payload was built for `version`
+    bool isCurrent(uint32_t version) const;
+
+    // rebuild the cached payload from `snapshot` and return it
+    const std::string& update(const Snapshot& snapshot);
+
+    const std::string& payload() const;
+    uint32_t           version() const;
+
+    // quoted entity tag for `version`, e.g. "\"1a2b3c4d\""
+    static std::string etag(uint32_t version);
+
+    // serialise `snapshot` into `out`, reusing its capacity
+    static void build(const Snapshot& snapshot, std::string& out);
+    static void appendEscaped(std::string& out, const std::string& text);
+
+private:
+    std::string cached;
+    uint32_t    cachedVersion = 0;
+    bool        valid         = false;
+};
@@ -0,0 +1,136 @@
+#include "UdpFrameReceiver.h"
+
+#include <algorithm>
+
+namespace
+{
+uint32_t readBigEndian32(const uint8_t* bytes)
+{
+    return (static_cast<uint32_t>(bytes[0]) << 24)
+         | (static_cast<uint32_t>(bytes[1]) << 16)
+         | (static_cast<uint32_t>(bytes[2]) << 8)
+         |  static_cast<uint32_t>(bytes[3]);
+}
+
+void writeBigEndian32(uint8_t* bytes, uint32_t value)
+{
+    bytes[0] = static_cast<uint8_t>(value >> 24);
+    bytes[1] = static_cast<uint8_t>(value >> 16);
+    bytes[2] = static_cast<uint8_t>(value >> 8);
+    bytes[3] = static_cast<uint8_t>(value);
+}
+} // namespace
+
+size_t UdpFrameReceiver::encode(uint32_t sequence, uint32_t timestampMs,
+                                const uint8_t* frames, size_t frameCount,
+                                uint8_t* out, size_t capacity)
+{
+    const size_t length = kHeaderBytes + frameCount * Image::kTotalBytes;
+    if (frames == nullptr || frameCount == 0 || frameCount > kMaxFrames || length > capacity)
+        return 0;
+
+    out[0] = kMagic[0];
+    out[1] = kMagic[1];
+    out[2] = kVersion;
+    out[3] = static_cast<uint8_t>(frameCount);
+    writeBigEndian32(out + 4, sequence);
+    writeBigEndian32(out + 8, timestampMs);
+    std::copy(frames, frames + frameCount * Image::kTotalBytes, out + kHeaderBytes);
+    return length;
+}
+
+UdpFrameReceiver::Result UdpFrameReceiver::receive(const uint8_t* data, size_t length, uint32_t nowMs)
+{
+    if (data == nullptr || length < kHeaderBytes || data[0] != kMagic[0] || data[1] != kMagic[1])
+    {
+        ++malformedPackets;
+        return Result::Malformed;
+    }
+    if (data[2] != kVersion)
+    {
+        ++unsupportedPackets;
+        return Result::Unsupported;
+    }
+
+    const size_t frameCount = data[3];
+    if (frameCount == 0 || frameCount > kMaxFrames || length != kHeaderBytes + frameCount * Image::kTotalBytes)
+    {
+        ++malformedPackets;
+        return Result::Malformed;
+    }
+
+    const uint32_t packetSequence = readBigEndian32(data + 4);
+    const uint32_t timestampMs    = readBigEndian32(data + 8);
+
+    const bool expired = !streaming || static_cast<uint32_t>(nowMs - lastArrivalMs) > LIVE_UDP_STREAM_TIMEOUT_MS;
+    if (!expired)
+    {
+        const int32_t ahead = static_cast<int32_t>(packetSequence - sequence);
+        if (ahead <= 0)
+        {
+            ++stalePackets;
+            return Result::Stale;
+        }
+        lostPackets += static_cast<uint32_t>(ahead - 1);
+
+        // RFC 3550, section 6.4.1: J += (|D| - J) / 16, kept as 16 * J
+        const int32_t transitDelta = static_cast<int32_t>(nowMs - lastArrivalMs)
+                                   - static_cast<int32_t>(timestampMs - lastTimestampMs);
+        const uint32_t deviation   = static_cast<uint32_t>(transitDelta < 0 ? -transitDelta : transitDelta);
+        jitterMs16 = jitterMs16 + deviation - jitterMs16 / 16u;
+    }
+    else
+    {
+        ++startedStreams;
+        jitterMs16 = 0;
+    }
+
+    streaming       = true;
+    sequence        = packetSequence;
+    lastArrivalMs   = nowMs;
+    lastTimestampMs = timestampMs;
+
+    // only the newest frame matters; it replaces one that was not shown yet
+    const uint8_t* newest = data + kHeaderBytes + (frameCount - 1) * Image::kTotalBytes;
+    std::copy(newest, newest + Image::kTotalBytes, pending.begin());
+    framePending = true;
+
+    ++acceptedPackets;
+    receivedFrames += static_cast<uint32_t>(frameCount);
+    return expired ? Result::Started : Result::Accepted;
+}
+
+bool UdpFrameReceiver::hasFrame() const
+{
+    return framePending;
+}
+
+bool UdpFrameReceiver::takeFrame(Matrix16x16& target)
+{
+    if (!framePending)
+        return false;
+
+    Image image;
+    for (int y = 0; y < Image::kHeight; ++y)
+    {
+        image.setRowBytes(y, pending.data() + y * Image::kRowBytes);
+    }
+    image.draw(target);
+
+    framePending = false;
+    ++shownFrames;
+    return true;
+}
+
+void UdpFrameReceiver::resetStats()
+{
+    acceptedPackets    = 0;
+    receivedFrames     = 0;
+    shownFrames        = 0;
+    lostPackets        = 0;
+    stalePackets       = 0;
+    malformedPackets   = 0;
+    unsupportedPackets = 0;
+    startedStreams     = 0;
+    jitterMs16         = 0;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <array>
+
+#include "config.h"
+#include "Image.h"
+#include "Matrix16x16.h"
+
+// Decoder for live frames sent as UDP datagrams (DisplayMode::Live).
+//
+// Datagram layout, multi-byte fields big-endian:
+//
+//   offset  size  field
+//        0     2  magic "LF"
+//        2     1  protocol version (kVersion)
+//        3     1  frame count n, 1..LIVE_UDP_MAX_FRAMES_PER_PACKET
+//        4     4  sequence number, +1 per datagram, wraps
+//        8     4  sender timestamp in ms, wraps
+//       12  n*32  frames, oldest first, rows MSB-first as in /api/images
+//
+// Unlike the WebSocket path there is no jitter buffer: the newest frame of
+// the newest datagram replaces whatever is pending and is shown at the next
+// poll. A datagram whose sequence number is not ahead of the last accepted
+// one is stale (reordered or duplicated) and dropped; gaps count as lost.
+// After LIVE_UDP_STREAM_TIMEOUT_MS without a datagram any sequence number
+// starts a new stream, so a restarted sender is picked up again. Earlier
+// frames of a datagram are the sender's history and are only counted.
+//
+// The transport is up to the caller (WiFiUDP on the device, a socket in the
+// native tests); receive() and takeFrame() must be called from one task.
+class UdpFrameReceiver
+{
+public:
+    static constexpr uint8_t kMagic[2]       = {'L', 'F'};
+    static constexpr uint8_t kVersion        = 1;
+    static constexpr size_t  kHeaderBytes    = 12;
+    static constexpr size_t  kMaxFrames      = LIVE_UDP_MAX_FRAMES_PER_PACKET;
+    static constexpr size_t  kMaxPacketBytes = kHeaderBytes + kMaxFrames * Image::kTotalBytes;
+
+    enum class Result
+    {
+        Started,     // accepted, first datagram of a stream
+        Accepted,
+        Stale,       // sequence number not ahead of the last accepted one
+        Malformed,   // bad magic, frame count or length
+        Unsupported  // other protocol version
+    };
+
+    // writes a datagram into `out` and returns its size, 0 if it does not fit
+    // or `frameCount` is out of range; `frames` holds frameCount * 32 bytes
+    static size_t encode(uint32_t sequence, uint32_t timestampMs,
+                         const uint8_t* frames, size_t frameCount,
+                         uint8_t* out, size_t capacity);
+
+    Result receive(const uint8_t* data, size_t length, uint32_t nowMs);
+
+    // copy the pending frame into `target`; false if none arrived since the last call
+    bool hasFrame() const;
+    bool takeFrame(Matrix16x16& target);
+
+    uint32_t packets() const      { return acceptedPackets; }
+    uint32_t frames() const       { return receivedFrames; }
+    uint32_t shown() const        { return shownFrames; }
+    uint32_t lost() const         { return lostPackets; }
+    uint32_t stale() const        { return stalePackets; }
+    uint32_t malformed() const    { return malformedPackets; }
+    uint32_t unsupported() const  { return unsupportedPackets; }
+    uint32_t streams() const      { return startedStreams; }
+    uint32_t lastSequence() const { return sequence; }
+
+    // RFC 3550 interarrival jitter: how much the arrival spacing differs
+    // from the sender's timestamp spacing, smoothed over ~16 datagrams
+    uint32_t jitterMs() const { return jitterMs16 / 16u; }
+
+    void resetStats();
+
+private:
+    std::array<uint8_t, Image::kTotalBytes> pending{};
+    bool                                    framePending = false;
+
+    bool     streaming       = false;
+    uint32_t sequence        = 0;
+    uint32_t lastArrivalMs   = 0;
+    uint32_t lastTimestampMs = 0;
+    uint32_t jitterMs16      = 0; // jitter estimate in 1/16 ms
+
+    uint32_t acceptedPackets    = 0;
+    uint32_t receivedFrames     = 0;
+    uint32_t shownFrames        = 0;
+    uint32_t lostPackets        = 0;
+    uint32_t stalePackets       = 0;
+    uint32_t malformedPackets   = 0;
+    uint32_t unsupportedPackets = 0;
+    uint32_t startedStreams     = 0;
+};
@@ -0,0 +1,407 @@
+// Generated by tools/build_web_assets.py from web/index.html - do not edit.
+#pragma once
+
+#include <Arduino.h>
+
+// minified web UI, 24969 bytes before compression
+constexpr size_t INDEX_HTML_GZ_LENGTH = 6321;
+constexpr char   INDEX_HTML_ETAG[]    = "\"fc8ba62cb27782eb\"";
+
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3d, 0xfd, 0x73, 0xda, 0xb8,
+    0xb6, 0xbf, 0xe7, 0xaf, 0x70, 0xe9, 0xdd, 0xd8, 0x6e, 0x0c, 0x01, 0x9a, 0xa4, 0x59, 0x1c, 0x93,
+    0xe9, 0x47, 0x7a, 0xdb, 0x79, 0x6d, 0xb7, 0xb3, 0x49, 0x77, 0xee, 0x9b, 0x4e, 0x66, 0xd7, 0x60,
+    0x01, 0xde, 0x1a, 0xcc, 0xb5, 0x4d, 0x02, 0x97, 0xf0, 0xbf, 0xbf, 0x73, 0x24, 0xd9, 0x96, 0x64,
+    0x19, 0xe8, 0xc7, 0xce, 0xbb, 0x3b, 0x74, 0x12, 0x2c, 0x9d, 0x73, 0x74, 0x74, 0x74, 0x74, 0xbe,
+    0x24, 0xa7, 0x17, 0x8f, 0x5e, 0xfd, 0xf2, 0xf2, 0xe6, 0x7f, 0x3f, 0x5e, 0x19, 0x93, 0x6c, 0x1a,
+    0xf5, 0x0f, 0x2e, 0xf0, 0x97, 0x11, 0xf9, 0xb3, 0xb1, 0xd7, 0x20, 0xb3, 0x06, 0x36, 0x10, 0x3f,
+    0x80, 0x5f, 0x53, 0x92, 0xf9, 0xc6, 0x70, 0xe2, 0x27, 0x29, 0xc9, 0xbc, 0xc6, 0x22, 0x1b, 0x35,
+    0xcf, 0x1b, 0x79, 0xf3, 0xcc, 0x9f, 0x12, 0xaf, 0x71, 0x17, 0x92, 0xfb, 0x79, 0x9c, 0x64, 0x0d,
+    0x63, 0x18, 0xcf, 0x32, 0x32, 0x03, 0xb0, 0xfb, 0x30, 0xc8, 0x26, 0x5e, 0x40, 0xee, 0xc2, 0x21,
+    0x69, 0xd2, 0x07, 0xc7, 0x08, 0x67, 0x61, 0x16, 0xfa, 0x51, 0x33, 0x1d, 0xfa, 0x11, 0xf1, 0x3a,
+    0x48, 0x24, 0x0b, 0xb3, 0x88, 0xf4, 0xdf, 0x5d, 0xbd, 0x32, 0xde, 0xfb, 0x59, 0x12, 0x2e, 0x8d,
+    0x97, 0x40, 0x20, 0x89, 0xa3, 0x88, 0x24, 0x17, 0xc7, 0xac, 0xf3, 0xe0, 0x22, 0xcd, 0x56, 0xf8,
+    0x7b, 0x10, 0x07, 0xab, 0xf5, 0x08, 0xfa, 0x9b, 0x23, 0x7f, 0x1a, 0x46, 0xab, 0xde, 0x35, 0x19,
+    0xc7, 0xc4, 0xf8, 0xf4, 0xd6, 0xf9, 0x35, 0x1e, 0xc4, 0x59, 0xec, 0xbc, 0x21, 0xd1, 0x1d, 0xc9,
+    0xc2, 0xa1, 0xef, 0x3c, 0x4f, 0x60, 0x1c, 0x27, 0xf5, 0x67, 0x69, 0x33, 0x25, 0x49, 0x38, 0x72,
+    0xa7, 0x7e, 0x32, 0x0e, 0x67, 0xbd, 0x4e, 0xeb, 0x2c, 0x21, 0x53, 0x77, 0xe0, 0x0f, 0xbf, 0x8c,
+    0x93, 0x78, 0x31, 0x0b, 0x7a, 0x8f, 0xdb, 0x03, 0xfc, 0xb8, 0xc3, 0x38, 0x8a, 0x93, 0xde, 0xe3,
+    0xd1, 0x09, 0x7e, 0xdc, 0xcd, 0xc1, 0xa4, 0xc3, 0x86, 0xba, 0x27, 0xe1, 0x78, 0x92, 0xf5, 0xce,
+    0xda, 0x6d, 0x4e, 0xa3, 0x09, 0x43, 0x65, 0xf1, 0x14, 0x48, 0x75, 0x91, 0xd4, 0x26, 0x25, 0xc3,
+    0x2c, 0x8c, 0x67, 0x6b, 0xb9, 0x97, 0xf5, 0x1d, 0xb4, 0x86, 0x7e, 0x12, 0xac, 0xc5, 0xe1, 0x3a,
+    0xa7, 0xf8, 0x71, 0x07, 0x71, 0x12, 0x90, 0xa4, 0x99, 0xf8, 0x41, 0xb8, 0x48, 0x7b, 0x9d, 0xb3,
+    0xf9, 0xd2, 0x9d, 0xfb, 0x41, 0x10, 0xce, 0xc6, 0x40, 0xf8, 0x94, 0xf2, 0x18, 0x2f, 0x9b, 0xe9,
+    0xc4, 0x0f, 0xe2, 0xfb, 0x5e, 0xdb, 0x68, 0x1b, 0xdd, 0x93, 0xf9, 0xd2, 0x48, 0xc6, 0x03, 0xdf,
+    0x6a, 0x3b, 0xf4, 0xd3, 0x3a, 0xb1, 0x81, 0xa3, 0x25, 0x93, 0x6d, 0xef, 0xb4, 0xdb, 0x06, 0x12,
+    0x9b, 0x83, 0xc8, 0x1f, 0x90, 0x68, 0x1d, 0x84, 0xe9, 0x3c, 0xf2, 0x57, 0xbd, 0x41, 0x14, 0x0f,
+    0xbf, 0xe4, 0x7c, 0x67, 0xf1, 0xbc, 0xd7, 0x41, 0xca, 0xea, 0xbc, 0x36, 0xe1, 0x6c, 0xbe, 0xc8,
+    0x3e, 0x67, 0xab, 0x39, 0xf1, 0x32, 0xb2, 0xcc, 0x6e, 0x9d, 0x94, 0x44, 0x30, 0x2b, 0x47, 0x68,
+    0x9f, 0x2d, 0xa6, 0x03, 0x92, 0xdc, 0xae, 0xd9, 0x68, 0x9d, 0x76, 0xfb, 0xa7, 0x82, 0xdf, 0x76,
+    0xeb, 0x8c, 0x33, 0x2c, 0x4d, 0x09, 0xf9, 0x61, 0x4d, 0xbd, 0x0e, 0xb0, 0x9e, 0xc6, 0x51, 0x18,
+    0x18, 0x8f, 0xbb, 0x03, 0xfc, 0xc8, 0x0b, 0x40, 0xf0, 0xa3, 0x2c, 0x80, 0xc0, 0x73, 0xbb, 0xf5,
+    0xb4, 0x14, 0x48, 0xf8, 0x1f, 0x1c, 0x92, 0x0f, 0x05, 0x2d, 0x30, 0x65, 0x81, 0xcb, 0x04, 0x94,
+    0x97, 0x48, 0x4c, 0x6a, 0xe8, 0xc0, 0xaa, 0xcc, 0xe2, 0x8c, 0xac, 0xa5, 0xae, 0xf3, 0x42, 0x30,
+    0x30, 0x04, 0xc1, 0x06, 0x0a, 0xcb, 0x99, 0x7a, 0xf6, 0xec, 0x19, 0xa0, 0x0d, 0x16, 0xb0, 0xb4,
+    0x33, 0x11, 0x8f, 0xeb, 0x00, 0x9f, 0xe6, 0x2c, 0x9e, 0x11, 0x45, 0x0a, 0x3f, 0xff, 0xfc, 0xb3,
+    0xb0, 0xb2, 0xed, 0xd6, 0x33, 0x00, 0x37, 0xb8, 0x12, 0x96, 0xa3, 0xd1, 0x55, 0x19, 0x2e, 0x92,
+    0x14, 0xc6, 0x9a, 0xc7, 0x21, 0xec, 0xa0, 0x44, 0x96, 0x50, 0x70, 0x46, 0x46, 0x41, 0x21, 0xa1,
+    0xd1, 0xc8, 0xcd, 0x60, 0xa6, 0x69, 0x88, 0x7a, 0xd7, 0x2b, 0x01, 0x8d, 0x76, 0xab, 0x9b, 0xba,
+    0x1b, 0xc6, 0x66, 0x6f, 0x12, 0xdf, 0x91, 0x44, 0x52, 0xbd, 0xee, 0xd9, 0x79, 0x1b, 0x70, 0x37,
+    0x07, 0x8f, 0xd3, 0xcc, 0xcf, 0x16, 0xe9, 0x5a, 0x55, 0x8c, 0x92, 0xcf, 0xf3, 0xba, 0x05, 0x15,
+    0x35, 0xb9, 0xdd, 0x3d, 0x7d, 0x1a, 0x68, 0xd6, 0xb8, 0x33, 0x3c, 0xf1, 0x9f, 0x05, 0x6e, 0xae,
+    0x84, 0x54, 0x2c, 0x20, 0xf4, 0x71, 0x12, 0x06, 0x85, 0x66, 0xe2, 0x83, 0x3b, 0xf6, 0xe7, 0xb9,
+    0xb6, 0xe3, 0x73, 0x33, 0x23, 0x53, 0xe8, 0xcc, 0x48, 0x13, 0x66, 0xba, 0x98, 0xce, 0xd2, 0x5e,
+    0x42, 0xe6, 0xc4, 0xcf, 0x2c, 0x7f, 0x91, 0xc5, 0xcd, 0x51, 0x98, 0x39, 0xd3, 0x70, 0x06, 0x2a,
+    0x6f, 0x75, 0xcf, 0x80, 0x17, 0xa7, 0x33, 0x4a, 0x6c, 0x1b, 0x09, 0xcf, 0x13, 0x82, 0x06, 0xa8,
+    0x49, 0xf7, 0x9a, 0x3a, 0xa7, 0x8d, 0x51, 0xf4, 0xdf, 0x27, 0xfe, 0x7c, 0x0e, 0x32, 0xc9, 0x79,
+    0x08, 0x67, 0x51, 0x38, 0x23, 0xcd, 0x51, 0x44, 0x96, 0xae, 0x1f, 0x85, 0xe3, 0x59, 0x33, 0x04,
+    0x0e, 0xd2, 0xde, 0x90, 0xd0, 0x15, 0x90, 0xf4, 0x83, 0x69, 0xce, 0xe3, 0x70, 0xea, 0x8f, 0xc9,
+    0x47, 0x46, 0x2f, 0x57, 0x33, 0x64, 0xc6, 0x9d, 0xb0, 0xed, 0xc4, 0x1e, 0xea, 0xd5, 0x5e, 0x92,
+    0xe8, 0xb9, 0x22, 0xd0, 0xf6, 0x29, 0x7e, 0x5c, 0x3a, 0x46, 0x33, 0x21, 0x33, 0x00, 0xc5, 0xd5,
+    0x98, 0x87, 0x4b, 0x82, 0x52, 0x29, 0x25, 0xca, 0xb6, 0xb5, 0x30, 0xb3, 0x14, 0x06, 0x81, 0x89,
+    0x31, 0x86, 0xba, 0xe7, 0x2a, 0x3f, 0xb0, 0xd9, 0x07, 0x5f, 0xc2, 0xac, 0x89, 0xd3, 0xf7, 0x41,
+    0x73, 0x86, 0xa4, 0xc7, 0x30, 0x9a, 0xa0, 0x22, 0x68, 0x2f, 0x23, 0xf7, 0x3e, 0x01, 0x6d, 0x9a,
+    0x8d, 0x9b, 0xd3, 0x38, 0x20, 0xbd, 0x41, 0xd6, 0x8c, 0x24, 0x0d, 0xa4, 0xea, 0x36, 0xf7, 0x81,
+    0xa7, 0x4c, 0xd5, 0x53, 0x2e, 0xa5, 0x88, 0x8c, 0xb2, 0x5e, 0xb3, 0x0b, 0x83, 0xa1, 0x38, 0x99,
+    0xc5, 0x42, 0x3e, 0x2a, 0x4c, 0xf6, 0x60, 0x12, 0xfe, 0x20, 0x22, 0xc1, 0x3a, 0x9e, 0xfb, 0xc3,
+    0x30, 0x5b, 0x81, 0x70, 0x4f, 0x72, 0xa2, 0xb0, 0x2f, 0x9b, 0x7e, 0x14, 0xc5, 0xf7, 0x30, 0x59,
+    0x01, 0x73, 0x14, 0x46, 0x04, 0x1d, 0xcd, 0x7a, 0xeb, 0x06, 0xd5, 0x6f, 0x75, 0x6a, 0x12, 0x9a,
+    0x38, 0x8f, 0x79, 0x55, 0x37, 0xd8, 0x7a, 0xde, 0x4c, 0x12, 0x92, 0x4e, 0xe2, 0x28, 0x10, 0x0d,
+    0x07, 0x0c, 0xcf, 0x50, 0xa9, 0xb3, 0x2a, 0x74, 0x86, 0x2a, 0xcb, 0x9f, 0x8b, 0x34, 0x0b, 0x47,
+    0xab, 0x26, 0x77, 0x76, 0x3d, 0x10, 0x0d, 0x38, 0xb9, 0x01, 0xc9, 0xee, 0x09, 0x99, 0xc9, 0x56,
+    0x44, 0xe0, 0xf1, 0xec, 0xec, 0x4c, 0xe6, 0xb1, 0x7b, 0xca, 0x15, 0x94, 0x0d, 0x74, 0xe7, 0x47,
+    0x0b, 0x52, 0x71, 0x3a, 0x1c, 0x39, 0x68, 0xe3, 0x07, 0x27, 0x34, 0x8a, 0xc1, 0x78, 0x25, 0xe2,
+    0x5c, 0xba, 0xc2, 0x20, 0xe7, 0xe7, 0xe7, 0xee, 0x66, 0xf2, 0x94, 0x77, 0xd3, 0x75, 0x68, 0x57,
+    0xcc, 0x4d, 0xab, 0x9d, 0x8f, 0x4c, 0x37, 0x00, 0x13, 0x8e, 0x66, 0x1f, 0x8f, 0xf0, 0xa3, 0x9a,
+    0x81, 0xae, 0xe8, 0xaa, 0x90, 0x8c, 0x2a, 0x55, 0xd9, 0x46, 0xe0, 0x47, 0x1e, 0xa9, 0x37, 0x0a,
+    0x93, 0x34, 0x6b, 0xc6, 0xa3, 0x26, 0xda, 0x6c, 0xc9, 0x0c, 0xe3, 0xfc, 0x50, 0x03, 0xe1, 0x69,
+    0x3c, 0x56, 0xa5, 0xae, 0xd9, 0xa2, 0x68, 0x40, 0xc0, 0xa8, 0x9e, 0x2a, 0x6c, 0xe4, 0x4d, 0x82,
+    0x3d, 0x3b, 0xa5, 0x86, 0x57, 0x30, 0xd6, 0x7b, 0xcd, 0x53, 0x3f, 0x15, 0x81, 0x43, 0x98, 0x17,
+    0x75, 0xb8, 0x15, 0x97, 0xca, 0xa1, 0xb8, 0xa1, 0xdd, 0xb1, 0xa8, 0x46, 0x8b, 0x4f, 0xb4, 0x99,
+    0xde, 0x87, 0xd9, 0x70, 0xb2, 0x9e, 0xc7, 0xdc, 0xb8, 0x27, 0xb8, 0xf3, 0xc3, 0x3b, 0xe2, 0x2a,
+    0x36, 0x8b, 0x59, 0x80, 0xdc, 0xf5, 0x97, 0xfb, 0x3d, 0xdf, 0x73, 0x32, 0x3d, 0x83, 0xba, 0xc8,
+    0x72, 0xc3, 0x71, 0xc4, 0x76, 0x8e, 0x25, 0xb3, 0xc0, 0x6c, 0x49, 0xc1, 0x82, 0x3f, 0x00, 0x31,
+    0x2d, 0x32, 0xa2, 0x6e, 0x7c, 0xb6, 0x60, 0x74, 0xdf, 0xb7, 0xdd, 0x84, 0xd3, 0xe1, 0xd1, 0x4f,
+    0x5b, 0x92, 0x5c, 0x77, 0x88, 0x1f, 0xd1, 0x67, 0x51, 0x47, 0xa5, 0xf3, 0x94, 0x15, 0x3e, 0x7a,
+    0x03, 0x32, 0x8a, 0x13, 0xa2, 0x63, 0x87, 0x6f, 0xbe, 0x46, 0xa3, 0x98, 0x3c, 0x0a, 0x82, 0xdb,
+    0x40, 0xfc, 0x4a, 0x79, 0x7b, 0x4a, 0xed, 0x31, 0xe5, 0xea, 0xa9, 0xb2, 0xa2, 0x8a, 0x23, 0xd5,
+    0x30, 0x75, 0xca, 0x0c, 0x81, 0x4e, 0x9a, 0xbd, 0xe1, 0x84, 0x0c, 0xbf, 0x90, 0xc0, 0x38, 0xaa,
+    0x88, 0x4e, 0xe3, 0xba, 0xbf, 0x9a, 0x48, 0x3e, 0x6f, 0xca, 0x1f, 0x7c, 0x9b, 0x32, 0x1b, 0x8c,
+    0x7e, 0xe0, 0x5f, 0x16, 0xc6, 0x82, 0x76, 0x45, 0x13, 0x27, 0xb0, 0x2e, 0x6b, 0xd1, 0x1c, 0xa3,
+    0xdb, 0x14, 0x0d, 0x64, 0xc5, 0x30, 0x6d, 0x0e, 0x2e, 0x8e, 0x79, 0x6c, 0x7d, 0x71, 0xcc, 0x83,
+    0x7d, 0x0c, 0xb2, 0x31, 0xf4, 0xef, 0xd4, 0x05, 0xe5, 0xd0, 0x73, 0x70, 0x11, 0x84, 0x77, 0xc6,
+    0x30, 0xf2, 0xd3, 0xd4, 0x6b, 0xa0, 0xe7, 0xc6, 0x48, 0x9e, 0xc7, 0xc1, 0x79, 0x33, 0x3a, 0xe3,
+    0x46, 0xff, 0x62, 0xd2, 0xed, 0x5f, 0x93, 0x0c, 0x5d, 0x4b, 0x0a, 0xa8, 0x5d, 0x19, 0x55, 0x60,
+    0x1f, 0x40, 0xc1, 0x8a, 0x16, 0xd8, 0x74, 0x57, 0x35, 0xfa, 0xaf, 0x98, 0x4c, 0x8c, 0xf7, 0x00,
+    0x08, 0xac, 0x02, 0x40, 0xff, 0x82, 0x76, 0xe5, 0x70, 0xb2, 0x50, 0x81, 0x08, 0x15, 0xab, 0x41,
+    0x83, 0xc1, 0x06, 0x15, 0x2e, 0xc4, 0x88, 0x0d, 0x23, 0x0c, 0xd8, 0x60, 0x37, 0x6c, 0x2c, 0xc3,
+    0x87, 0xf4, 0xa0, 0x49, 0x09, 0x79, 0x0d, 0xd6, 0x66, 0x70, 0xeb, 0x6d, 0x60, 0x00, 0x6c, 0xf8,
+    0x10, 0x4c, 0x51, 0xd7, 0x90, 0x2a, 0x7c, 0xc9, 0x8b, 0x04, 0x9d, 0x9c, 0xa9, 0x63, 0x4a, 0x8c,
+    0xc3, 0xe6, 0xa3, 0x5d, 0xd3, 0xcd, 0xdf, 0x90, 0x66, 0xcb, 0x0c, 0x42, 0xa3, 0x7f, 0x03, 0xc3,
+    0xe4, 0xc8, 0xe2, 0x00, 0xb8, 0x88, 0xac, 0xd7, 0x38, 0x36, 0xde, 0x52, 0x16, 0x8a, 0x31, 0x40,
+    0x72, 0xb2, 0xfc, 0x4a, 0x9b, 0x8a, 0x92, 0x7e, 0xda, 0x7f, 0x41, 0xb7, 0xe1, 0x8c, 0xa4, 0x28,
+    0xeb, 0xa7, 0x7d, 0x11, 0x54, 0x70, 0x83, 0x85, 0x94, 0x90, 0xcf, 0x41, 0x81, 0xf2, 0x2b, 0x42,
+    0x34, 0xb8, 0xe8, 0x12, 0xf6, 0x00, 0xf1, 0x96, 0xd7, 0x68, 0xc3, 0x6f, 0x7f, 0xe9, 0x35, 0xc0,
+    0x2d, 0x36, 0x8c, 0x34, 0x23, 0x73, 0xf8, 0xda, 0x30, 0xa8, 0xb7, 0xe2, 0x8d, 0xa2, 0x38, 0x4b,
+    0x1e, 0x1a, 0x1a, 0x06, 0xa8, 0x33, 0xe5, 0x32, 0xed, 0xb7, 0x7f, 0x92, 0x24, 0x20, 0xb3, 0xf3,
+    0x1b, 0xd2, 0x6f, 0xc8, 0xd8, 0x74, 0xcc, 0x46, 0x1f, 0xfd, 0xb3, 0x88, 0x29, 0x35, 0x50, 0x29,
+    0x89, 0x3f, 0x51, 0xc7, 0x99, 0x6a, 0x6e, 0x53, 0x52, 0x2a, 0xf1, 0xe7, 0x33, 0x58, 0x74, 0xec,
+    0xe7, 0xaa, 0x8a, 0xfb, 0x8e, 0xb2, 0x85, 0x4a, 0xf1, 0x1a, 0x1e, 0x1a, 0xdb, 0xe5, 0xff, 0xce,
+    0x5f, 0xc5, 0x8b, 0x8c, 0xc9, 0x9e, 0xa5, 0x50, 0x05, 0x36, 0xeb, 0x6a, 0xf0, 0x7c, 0x39, 0x62,
+    0x4f, 0xfd, 0x8b, 0x78, 0x4e, 0xd9, 0xe1, 0xc2, 0x0c, 0x16, 0x3e, 0x28, 0xfd, 0xf5, 0x3c, 0x0a,
+    0x33, 0x83, 0x6b, 0x9a, 0x61, 0x65, 0xf7, 0xb1, 0x81, 0x03, 0xa5, 0xf6, 0xc5, 0x31, 0x03, 0x57,
+    0xd1, 0x52, 0xd8, 0x5d, 0x11, 0xf9, 0x1d, 0x0c, 0x32, 0x20, 0xd3, 0xef, 0x14, 0x01, 0x50, 0xe3,
+    0xf9, 0x2e, 0x24, 0x66, 0x1a, 0x15, 0x3c, 0xd6, 0x58, 0x8b, 0xca, 0x9c, 0x6f, 0xa3, 0xff, 0x92,
+    0xfe, 0x36, 0xac, 0xd1, 0x22, 0x8a, 0x72, 0x7e, 0x05, 0xa4, 0x63, 0x26, 0x02, 0x49, 0x71, 0xa9,
+    0x38, 0xe2, 0xf9, 0x3b, 0x18, 0xe6, 0x9a, 0x2d, 0x45, 0xa3, 0x46, 0x98, 0x22, 0xe8, 0x1b, 0x30,
+    0x4d, 0xc0, 0x1f, 0xec, 0x8b, 0x78, 0x6e, 0x60, 0x03, 0x15, 0xf1, 0x01, 0x37, 0x05, 0xb0, 0x4a,
+    0x14, 0x12, 0x97, 0xf0, 0x2d, 0x2a, 0x76, 0xbe, 0xbb, 0xf8, 0x9e, 0x2c, 0x95, 0x5d, 0x02, 0xe2,
+    0x4b, 0xc1, 0xdb, 0xa8, 0x8e, 0x43, 0x94, 0x39, 0xce, 0x26, 0x5e, 0xe3, 0xec, 0xa4, 0x61, 0xc0,
+    0x64, 0x86, 0x04, 0x83, 0x42, 0x02, 0xd4, 0xaf, 0xe8, 0x44, 0x01, 0x94, 0x0a, 0xa8, 0xa1, 0x1d,
+    0x1a, 0x6d, 0x54, 0xa3, 0x5f, 0xa8, 0x10, 0xb7, 0x59, 0xb9, 0x5d, 0x10, 0xb4, 0x41, 0x00, 0x2f,
+    0x79, 0x60, 0xd8, 0x8a, 0xa0, 0x71, 0xf8, 0x46, 0xff, 0x0d, 0xfc, 0x34, 0x2c, 0x34, 0x1c, 0xe1,
+    0xb0, 0x7e, 0x39, 0x87, 0x68, 0x9f, 0x61, 0x1d, 0xe9, 0xef, 0x3a, 0x28, 0xa0, 0xf0, 0x05, 0x57,
+    0xee, 0x86, 0xfe, 0xae, 0x2e, 0x95, 0x6e, 0x5e, 0xaf, 0x13, 0xe0, 0xb1, 0xd1, 0xa7, 0xbf, 0x8c,
+    0x57, 0x8b, 0x84, 0xcd, 0xce, 0x9a, 0xa2, 0x3e, 0x4a, 0x12, 0x66, 0x96, 0x83, 0x15, 0x0a, 0x1a,
+    0xe2, 0x54, 0x19, 0x85, 0x72, 0xae, 0xf4, 0x39, 0xa7, 0x54, 0x1a, 0x19, 0xc1, 0xa2, 0x54, 0x74,
+    0x86, 0x69, 0xe4, 0xbe, 0x6a, 0x53, 0x42, 0x17, 0x9a, 0xf3, 0x82, 0x36, 0xd5, 0x28, 0x0f, 0x83,
+    0xdf, 0xad, 0x3f, 0x2a, 0x1c, 0x9f, 0x52, 0xd9, 0xbc, 0x8f, 0x16, 0x31, 0x68, 0x9d, 0x22, 0x95,
+    0x74, 0xf6, 0xd5, 0x25, 0x05, 0x43, 0xe2, 0xe7, 0xbf, 0x50, 0xa3, 0x4a, 0x76, 0xbf, 0x43, 0xa9,
+    0x54, 0x22, 0xd2, 0xa4, 0xbf, 0x42, 0xb5, 0x8e, 0xd1, 0xba, 0xf7, 0xf7, 0x72, 0x0e, 0xd4, 0x0f,
+    0x57, 0xbc, 0x83, 0x30, 0x31, 0x1a, 0x2b, 0xbc, 0x86, 0x2c, 0x15, 0x9c, 0xde, 0xa7, 0x79, 0x14,
+    0xfb, 0x01, 0xf7, 0xdd, 0x86, 0xe5, 0xcf, 0x56, 0x08, 0x03, 0x98, 0xb6, 0x46, 0xa3, 0x04, 0x44,
+    0x3e, 0x55, 0xcc, 0x75, 0xc1, 0xa3, 0x0e, 0x87, 0x64, 0x9e, 0xf1, 0xfe, 0xe3, 0x27, 0x30, 0x93,
+    0x45, 0x94, 0x85, 0x73, 0x1a, 0xa9, 0xd5, 0x7a, 0x75, 0x95, 0xa1, 0x22, 0xaf, 0x05, 0xf5, 0x0f,
+    0x67, 0xe0, 0xa4, 0xff, 0xc3, 0xc4, 0x5c, 0xb4, 0xd7, 0x31, 0x54, 0x22, 0x6e, 0x09, 0x07, 0xba,
+    0xa7, 0xa7, 0xa5, 0x60, 0xbb, 0xe7, 0xbb, 0xbd, 0x7d, 0xc5, 0xd9, 0x67, 0xf9, 0x30, 0xdb, 0x7c,
+    0x7d, 0xf7, 0x5c, 0x72, 0xf5, 0x30, 0xaa, 0xc6, 0xd3, 0xf3, 0xc5, 0xd8, 0x16, 0xfe, 0xd1, 0x89,
+    0xbd, 0x9d, 0x61, 0xc1, 0xa3, 0xd1, 0x37, 0xd8, 0x17, 0x03, 0x9c, 0xf0, 0x7c, 0x51, 0xec, 0x74,
+    0xcd, 0x92, 0x7e, 0xbb, 0x9a, 0x0a, 0xf8, 0xaa, 0x1a, 0x76, 0x51, 0x0d, 0xf7, 0x65, 0xf9, 0x5d,
+    0x0c, 0x6e, 0xdd, 0xe0, 0x79, 0x42, 0xdf, 0xc0, 0x47, 0xb4, 0x2a, 0x2b, 0x4c, 0x32, 0x4a, 0xc6,
+    0x59, 0xcd, 0x8f, 0x53, 0x61, 0x0f, 0x8c, 0xc6, 0x38, 0xf1, 0x57, 0x74, 0x19, 0x5e, 0xb0, 0xc6,
+    0xfe, 0xf5, 0x24, 0xbe, 0x37, 0x5e, 0x63, 0x06, 0xce, 0x54, 0x14, 0x12, 0x11, 0xe3, 0x9f, 0x39,
+    0xd0, 0xc5, 0x31, 0xc3, 0x95, 0xb5, 0x4c, 0xac, 0xaf, 0xc9, 0xcb, 0xac, 0x54, 0xd6, 0xa0, 0x73,
+    0xe8, 0xcf, 0xee, 0xfc, 0xb4, 0x64, 0x9f, 0xd7, 0xca, 0x1a, 0x06, 0x3b, 0x0f, 0x68, 0x74, 0xce,
+    0x40, 0x0e, 0x2c, 0x5f, 0x63, 0x0f, 0xb0, 0x82, 0x0c, 0xa7, 0xa2, 0x85, 0x1c, 0xf5, 0x9a, 0x85,
+    0xda, 0xea, 0x90, 0x3c, 0x02, 0xd7, 0x28, 0x68, 0x27, 0x8f, 0x57, 0x4b, 0xf5, 0x6c, 0x18, 0x71,
+    0x12, 0xd2, 0x63, 0x89, 0xbc, 0xe0, 0x25, 0x07, 0xad, 0x7c, 0x28, 0x16, 0xf3, 0x1b, 0xcc, 0x74,
+    0xc5, 0x49, 0x6e, 0x2b, 0x0a, 0x2f, 0xc4, 0xc7, 0x7e, 0xcd, 0xcb, 0x51, 0x15, 0x9e, 0xf2, 0x3a,
+    0x55, 0xa3, 0xff, 0x21, 0x36, 0xf0, 0x81, 0x93, 0x22, 0x81, 0xac, 0xac, 0x39, 0x3d, 0x3a, 0xdc,
+    0xf5, 0x62, 0x0a, 0x49, 0xdb, 0x0a, 0x43, 0x6b, 0xc8, 0xc4, 0x20, 0x4d, 0xa8, 0x94, 0xa5, 0x79,
+    0x0a, 0xe7, 0xfb, 0xbe, 0x5b, 0xb0, 0x24, 0x98, 0x2d, 0x85, 0x68, 0x9e, 0x61, 0x68, 0xf2, 0x05,
+    0x56, 0x3a, 0x82, 0xb4, 0x8a, 0x9e, 0xca, 0xf4, 0x8c, 0x72, 0x2b, 0xb2, 0x73, 0x9a, 0x37, 0x71,
+    0x9a, 0x09, 0x39, 0x0d, 0xc3, 0x07, 0x3f, 0x10, 0xce, 0xc1, 0x90, 0x43, 0xbe, 0x0d, 0x3a, 0xc3,
+    0xa8, 0xbf, 0x88, 0x97, 0x5e, 0x10, 0x0f, 0x17, 0x53, 0x90, 0x69, 0x6b, 0x4c, 0xb2, 0xab, 0x88,
+    0xe0, 0xd7, 0x17, 0xab, 0xb7, 0x81, 0x65, 0x32, 0x10, 0xd3, 0x76, 0x19, 0x86, 0x92, 0x61, 0xd4,
+    0xe3, 0x29, 0x80, 0x1a, 0x02, 0xd4, 0x4e, 0xec, 0x43, 0x80, 0x02, 0x16, 0x04, 0xf2, 0xe8, 0xbd,
+    0x1e, 0x33, 0x87, 0x28, 0x51, 0x84, 0x48, 0x71, 0x0b, 0x9a, 0x00, 0xa5, 0xa2, 0xa2, 0xfb, 0xdd,
+    0x89, 0x89, 0x40, 0x2a, 0x22, 0xb5, 0x19, 0x3b, 0x31, 0x29, 0x54, 0x29, 0x22, 0x39, 0x30, 0xd9,
+    0x22, 0x22, 0x19, 0x50, 0x43, 0x60, 0x3b, 0xdf, 0x32, 0x9c, 0x06, 0x7d, 0x07, 0xf7, 0x0a, 0xa0,
+    0xb4, 0x44, 0x2c, 0x45, 0xda, 0xbe, 0x48, 0x0c, 0x46, 0x14, 0x99, 0x10, 0x13, 0x6e, 0x15, 0x9a,
+    0x00, 0xa7, 0xb0, 0xbd, 0x17, 0x85, 0x0a, 0xa8, 0xca, 0x03, 0x8f, 0x34, 0x77, 0xf2, 0xc0, 0xe1,
+    0x34, 0x3c, 0xec, 0xa4, 0x50, 0x01, 0x2d, 0x88, 0x94, 0xb5, 0x8d, 0x7a, 0xec, 0x12, 0x46, 0x42,
+    0x63, 0x45, 0x8a, 0xed, 0x68, 0xd7, 0xf2, 0x8e, 0x2e, 0x83, 0x96, 0x7a, 0xb4, 0x12, 0x46, 0x41,
+    0xdb, 0xae, 0x1f, 0x25, 0x8c, 0x8c, 0x86, 0x6e, 0x6f, 0x07, 0x16, 0x82, 0xc8, 0x48, 0xdc, 0xb2,
+    0xee, 0xc0, 0xe3, 0x50, 0x32, 0x6a, 0x11, 0x01, 0xed, 0x40, 0x2e, 0xe0, 0x4a, 0x75, 0x90, 0x82,
+    0x9a, 0x2d, 0xea, 0x20, 0xc1, 0xc9, 0xa3, 0xb3, 0xe8, 0x64, 0xc7, 0xd0, 0x0c, 0xa8, 0x40, 0xe4,
+    0x3e, 0xe8, 0x25, 0xf5, 0xa5, 0x3b, 0x50, 0xb9, 0xbb, 0xab, 0xe0, 0x66, 0x4b, 0x4f, 0x22, 0x83,
+    0xd8, 0x58, 0xfa, 0x83, 0x8d, 0x67, 0x99, 0xdd, 0x40, 0x85, 0x67, 0x9e, 0x79, 0xbf, 0xb1, 0x18,
+    0xac, 0x4a, 0x21, 0xf7, 0xa4, 0xf5, 0x34, 0x14, 0x40, 0x20, 0xc0, 0x1d, 0xd1, 0xcd, 0xd5, 0xbf,
+    0x6e, 0x7e, 0xff, 0xf4, 0xf1, 0xd5, 0xf3, 0x9b, 0xab, 0xdf, 0x5f, 0x5d, 0xbd, 0xf8, 0xe5, 0xd3,
+    0x87, 0x97, 0x57, 0xbf, 0xbf, 0xbf, 0xf6, 0x9e, 0xd2, 0xf2, 0x3a, 0x42, 0xbc, 0x7d, 0xff, 0xfc,
+    0x9f, 0x57, 0x00, 0xf2, 0xee, 0x97, 0xe7, 0xaf, 0x24, 0x10, 0xac, 0xc0, 0x1f, 0x44, 0x44, 0xf4,
+    0x2c, 0x9f, 0xe6, 0x81, 0x9f, 0x91, 0x9b, 0x70, 0x0a, 0xf3, 0x99, 0x2d, 0xa2, 0x88, 0xf5, 0xe3,
+    0xc4, 0xf5, 0x3d, 0x74, 0x6a, 0x2c, 0xd2, 0x57, 0xbb, 0xd2, 0xc5, 0x1c, 0x98, 0x4e, 0xd3, 0xf7,
+    0xe5, 0x9e, 0x1c, 0xf9, 0x51, 0x4a, 0x58, 0xaf, 0x30, 0x9f, 0xd4, 0xfb, 0x7c, 0x2b, 0x35, 0x5e,
+    0xf3, 0x60, 0xe1, 0xed, 0x2c, 0x20, 0x4b, 0xaf, 0x2d, 0xf5, 0xbd, 0x8b, 0xe9, 0x8e, 0xbf, 0x89,
+    0xbf, 0x90, 0x99, 0xd2, 0x75, 0x1d, 0x2f, 0x92, 0x21, 0xa1, 0xc1, 0x9c, 0xc0, 0xc6, 0x70, 0x91,
+    0xe0, 0x71, 0x1d, 0x6e, 0x5d, 0xb1, 0x19, 0x02, 0x81, 0xec, 0x7f, 0x66, 0xf1, 0xfd, 0x8c, 0xda,
+    0x79, 0x6a, 0x53, 0x4d, 0x09, 0x81, 0xc5, 0x06, 0x74, 0x0b, 0xbe, 0x01, 0x2e, 0x44, 0x32, 0x87,
+    0x87, 0xe2, 0x53, 0x8b, 0x15, 0x48, 0x2f, 0x35, 0x6d, 0x2d, 0x7a, 0xc2, 0x43, 0x69, 0x3c, 0x3c,
+    0xe0, 0xd8, 0x3d, 0xca, 0x40, 0x4a, 0xb2, 0xb2, 0x3a, 0xf8, 0xe9, 0xad, 0xb5, 0x85, 0x76, 0xb9,
+    0x32, 0x97, 0x1f, 0x68, 0x50, 0x6d, 0xd5, 0x74, 0xb7, 0x20, 0xec, 0xc4, 0x7a, 0x94, 0x8d, 0xa7,
+    0x76, 0xa0, 0x1c, 0xa3, 0xc5, 0x8c, 0x25, 0x71, 0xb0, 0xb7, 0xee, 0x99, 0xdd, 0x82, 0x70, 0x7d,
+    0xec, 0x84, 0xe9, 0x55, 0x92, 0x40, 0x5c, 0x4f, 0x97, 0xc2, 0x5e, 0x17, 0x61, 0x4c, 0x8b, 0x46,
+    0x5d, 0x79, 0xf1, 0xdd, 0x33, 0xe9, 0xc1, 0x8a, 0xe9, 0x96, 0xfd, 0x28, 0xa1, 0x97, 0xfc, 0x52,
+    0x0b, 0x10, 0x72, 0x55, 0xcc, 0xb2, 0xd8, 0xef, 0xf1, 0x31, 0x2e, 0xcd, 0xc7, 0x4f, 0x03, 0x3c,
+    0x2b, 0x32, 0x7b, 0x26, 0x3f, 0x24, 0x37, 0xab, 0x68, 0xf4, 0x9c, 0xe1, 0x25, 0x46, 0x76, 0x02,
+    0xde, 0x39, 0x40, 0x77, 0x4f, 0x29, 0x1e, 0x3d, 0x43, 0x37, 0xdd, 0x4d, 0x39, 0xa3, 0x05, 0xd5,
+    0xc4, 0x52, 0x82, 0xef, 0x30, 0x76, 0xb5, 0xec, 0x35, 0xd3, 0x76, 0xc8, 0x3d, 0x48, 0x12, 0x0e,
+    0x3d, 0x2e, 0x2e, 0x25, 0x98, 0x6a, 0xd1, 0x48, 0x38, 0xdf, 0x7d, 0x10, 0x0e, 0x4e, 0xe7, 0x24,
+    0xe0, 0xb0, 0xad, 0x30, 0x7d, 0x8d, 0x37, 0x73, 0x88, 0xc5, 0x69, 0xd8, 0x97, 0xfc, 0x0b, 0x9e,
+    0xe3, 0xc8, 0x31, 0x95, 0x24, 0x8e, 0xf7, 0x7e, 0x36, 0x69, 0xd1, 0xa9, 0x5b, 0x9c, 0xa2, 0x7d,
+    0x64, 0xfe, 0x24, 0xf1, 0xac, 0x2e, 0x39, 0x63, 0x43, 0xcf, 0xf2, 0xd7, 0xb1, 0x48, 0x07, 0x87,
+    0x78, 0xdf, 0x62, 0x5f, 0xfc, 0x65, 0xde, 0xe5, 0xb4, 0x6d, 0x07, 0x75, 0x01, 0x15, 0xc2, 0xd5,
+    0x8a, 0xc1, 0xe3, 0xc4, 0xbf, 0x71, 0x72, 0x7e, 0xba, 0x9a, 0x0d, 0x8d, 0x62, 0x8a, 0x73, 0x08,
+    0x9a, 0xcb, 0x39, 0xe6, 0x33, 0xcc, 0x92, 0x15, 0x9f, 0xe5, 0xdc, 0x87, 0x7d, 0x90, 0x7a, 0x33,
+    0x48, 0x2f, 0x3e, 0xfd, 0xfa, 0xee, 0x9a, 0xf8, 0xc9, 0x70, 0xf2, 0x91, 0xb6, 0x59, 0xb6, 0xcb,
+    0x3a, 0x5b, 0x20, 0x26, 0xcb, 0xa4, 0x98, 0xa6, 0x23, 0x89, 0x01, 0x0c, 0x89, 0xe7, 0xdf, 0xfb,
+    0x61, 0x66, 0x8c, 0x48, 0x36, 0x9c, 0x58, 0xe6, 0xb1, 0x3f, 0x0f, 0x8f, 0x4b, 0xbe, 0x4d, 0x67,
+    0x3d, 0x25, 0xd9, 0x24, 0x0e, 0x7a, 0xe6, 0xc7, 0x5f, 0xae, 0x6f, 0x4c, 0x07, 0x4f, 0x71, 0x48,
+    0x92, 0xf6, 0xd6, 0x26, 0x9f, 0x48, 0xf3, 0x06, 0x12, 0x24, 0xd0, 0x28, 0x48, 0xd0, 0x22, 0x48,
+    0x7c, 0x90, 0xe5, 0xe3, 0x65, 0xf3, 0xfe, 0x1e, 0xb2, 0x15, 0x08, 0x78, 0x9b, 0x8b, 0x04, 0x0c,
+    0xeb, 0x10, 0x6c, 0x41, 0x60, 0x6e, 0x1c, 0x3c, 0xfb, 0xe9, 0x31, 0x96, 0x36, 0x39, 0x07, 0xa0,
+    0x73, 0x3e, 0x67, 0x01, 0x98, 0x69, 0xfd, 0x99, 0xc6, 0x33, 0xe0, 0x3b, 0x1c, 0x59, 0x8f, 0xf0,
+    0x31, 0xfe, 0xf2, 0xf0, 0xf0, 0x08, 0x41, 0xe0, 0x9b, 0x0d, 0x2e, 0x0d, 0x72, 0x4b, 0x9c, 0x28,
+    0xd5, 0x67, 0x8b, 0xb6, 0x4f, 0x81, 0x4b, 0xb0, 0x09, 0x0f, 0x0f, 0x66, 0x29, 0x24, 0xae, 0xca,
+    0xc6, 0xc8, 0x07, 0x33, 0x88, 0x6e, 0x05, 0xc8, 0x51, 0xe0, 0x72, 0x62, 0x87, 0x87, 0x98, 0xd8,
+    0xc5, 0x23, 0x43, 0x69, 0xcf, 0xf7, 0xbb, 0xe7, 0x79, 0x26, 0x4b, 0xb7, 0x4d, 0xd8, 0xcd, 0x8a,
+    0x96, 0x71, 0x85, 0xaa, 0x41, 0xc5, 0x4b, 0x23, 0xf9, 0x80, 0x9c, 0x3b, 0x20, 0x51, 0x9a, 0x0b,
+    0xa9, 0xc3, 0xdd, 0x10, 0x30, 0x18, 0x62, 0x77, 0x75, 0x1e, 0x38, 0x83, 0xcd, 0x06, 0x64, 0x0b,
+    0x0b, 0x44, 0x92, 0x84, 0xa9, 0x77, 0x0c, 0x9b, 0x9c, 0x50, 0x31, 0x60, 0x93, 0x2b, 0x10, 0x80,
+    0xe7, 0x7d, 0xa4, 0xe2, 0x64, 0x09, 0xea, 0xc1, 0x46, 0xdc, 0x4d, 0xc3, 0x09, 0x09, 0x16, 0x91,
+    0x60, 0x03, 0x98, 0x77, 0xb2, 0xc2, 0xe9, 0x94, 0x04, 0x21, 0x5a, 0x7a, 0x6e, 0xdf, 0x60, 0x7e,
+    0x5a, 0xe7, 0x06, 0xbc, 0x45, 0xa0, 0x81, 0xf8, 0x1d, 0xe2, 0xe8, 0x1a, 0x18, 0x77, 0x8b, 0x5f,
+    0x44, 0xc9, 0x15, 0xa3, 0xd9, 0x6b, 0x45, 0xf9, 0x6b, 0xac, 0x4e, 0x42, 0xb2, 0x45, 0x32, 0x73,
+    0x37, 0x7a, 0xba, 0xb0, 0x7a, 0x39, 0x3f, 0x96, 0xed, 0xf5, 0xd7, 0x5b, 0x46, 0xdf, 0x6f, 0xb8,
+    0x8d, 0xd3, 0x39, 0x6d, 0xdb, 0x55, 0xd3, 0xf9, 0xbe, 0x08, 0x65, 0x2d, 0x8c, 0x6a, 0xa9, 0x94,
+    0x1e, 0x95, 0xf1, 0xad, 0xcd, 0xd9, 0x64, 0x7a, 0x4f, 0x2b, 0x03, 0xa9, 0xb7, 0xa6, 0x1e, 0xad,
+    0x67, 0xb2, 0x72, 0x9e, 0xe9, 0x14, 0xf5, 0x94, 0x9e, 0x59, 0x54, 0x4d, 0x4c, 0x27, 0x0a, 0xef,
+    0xa0, 0xe1, 0x1d, 0xfc, 0x34, 0x37, 0x6e, 0x49, 0x51, 0x32, 0x28, 0x8c, 0xe0, 0x67, 0xec, 0xbd,
+    0x85, 0x75, 0xbf, 0xa1, 0x9e, 0x57, 0x5c, 0x5c, 0xb0, 0x2a, 0x65, 0xcc, 0xa0, 0x70, 0xc8, 0x1a,
+    0x73, 0x0e, 0x35, 0x21, 0x06, 0x2a, 0x8b, 0x5b, 0x42, 0xb6, 0x78, 0xc1, 0xc8, 0xc3, 0x26, 0xdc,
+    0x2b, 0x74, 0x1a, 0xa6, 0x5b, 0x1b, 0x9c, 0xe8, 0x25, 0xa4, 0xb7, 0x76, 0x08, 0x45, 0xfb, 0x1d,
+    0xc0, 0x8d, 0xd0, 0x01, 0xbe, 0xa7, 0xcc, 0x7e, 0x83, 0xcd, 0x43, 0x2a, 0xa6, 0xc3, 0xc6, 0xda,
+    0x66, 0xf1, 0x18, 0xdc, 0xdf, 0xc7, 0xd6, 0xa1, 0x40, 0xf0, 0xca, 0x2c, 0x68, 0x65, 0x69, 0xe5,
+    0xe4, 0xd8, 0x0b, 0xa7, 0x84, 0xb4, 0xc5, 0xc0, 0xc6, 0x96, 0xa2, 0x9c, 0x69, 0x01, 0x56, 0xb3,
+    0x3a, 0xdf, 0x61, 0xc5, 0x64, 0xbd, 0xb8, 0x34, 0xaf, 0xe9, 0x01, 0x3a, 0x09, 0x20, 0x9d, 0xe5,
+    0x55, 0x30, 0x3f, 0x2f, 0x77, 0x83, 0x40, 0xc5, 0x5e, 0x7e, 0x40, 0x9e, 0x77, 0x02, 0xed, 0x84,
+    0x8c, 0x30, 0x97, 0xa1, 0x4c, 0x83, 0xbc, 0xbe, 0xd5, 0x12, 0x6a, 0x64, 0xc6, 0x6d, 0xa0, 0xb2,
+    0x35, 0x24, 0xad, 0x53, 0xa4, 0x2a, 0xf6, 0xa1, 0xed, 0xd4, 0xa8, 0x2f, 0xee, 0x3c, 0xeb, 0x9b,
+    0xb4, 0x95, 0xd7, 0x5e, 0x80, 0x2d, 0xa1, 0xf0, 0xc3, 0xac, 0x0e, 0xf0, 0x6f, 0x56, 0x80, 0x69,
+    0x8d, 0xc4, 0x11, 0x6a, 0x3d, 0xb9, 0x85, 0x52, 0xe0, 0xa4, 0x53, 0x8b, 0x02, 0x81, 0xb6, 0x16,
+    0xd4, 0xdb, 0x0a, 0xf9, 0xb2, 0x92, 0x62, 0x3a, 0x4a, 0x55, 0xa7, 0x8e, 0xa3, 0xf2, 0x5c, 0x48,
+    0x44, 0xa9, 0xe3, 0x4b, 0x73, 0xa0, 0x22, 0xa2, 0x6d, 0xe7, 0x8e, 0x1d, 0x70, 0xc3, 0x54, 0x8a,
+    0x9a, 0x4d, 0x6b, 0x8f, 0xb8, 0x86, 0x66, 0x23, 0x7f, 0xa3, 0x5d, 0xfe, 0x49, 0x09, 0x63, 0x6a,
+    0xb6, 0x1f, 0xb7, 0xf6, 0x42, 0xb4, 0xf0, 0x83, 0x76, 0xcc, 0xa7, 0x7d, 0x03, 0x86, 0x9b, 0x22,
+    0x91, 0xd5, 0x86, 0x0a, 0x4a, 0x9e, 0xab, 0x04, 0x09, 0x6a, 0xaf, 0xab, 0x4d, 0x8b, 0x35, 0x81,
+    0x01, 0xdb, 0x68, 0x85, 0xf7, 0x57, 0xd1, 0x54, 0xbf, 0xaf, 0x25, 0x2b, 0xd0, 0xd9, 0x38, 0x35,
+    0x39, 0xbf, 0xe4, 0xea, 0x51, 0x2b, 0x56, 0x4c, 0xe5, 0x7e, 0x0b, 0xd3, 0x70, 0x10, 0x46, 0x61,
+    0xb6, 0xb2, 0x98, 0x3e, 0xfe, 0x26, 0x66, 0x1f, 0x2c, 0x15, 0x10, 0x7b, 0x1e, 0x1e, 0x54, 0x75,
+    0x05, 0x19, 0xe3, 0x9d, 0x8c, 0xb2, 0x3a, 0x93, 0xbe, 0x82, 0x47, 0x8f, 0xa1, 0x82, 0xf5, 0xa4,
+    0x9d, 0x45, 0x1f, 0xbb, 0x43, 0xc1, 0x4e, 0x9a, 0x4b, 0x18, 0xe9, 0xa2, 0x45, 0x09, 0xcc, 0x2e,
+    0x4f, 0x94, 0x60, 0xec, 0x52, 0x85, 0x89, 0x7a, 0x28, 0x57, 0x2b, 0xc1, 0x52, 0x49, 0xcf, 0x4a,
+    0xc6, 0x2a, 0x0f, 0x7b, 0x69, 0xe2, 0x6d, 0x6b, 0xd8, 0x1c, 0x26, 0x5d, 0x90, 0x4a, 0xd5, 0xd2,
+    0x5e, 0x57, 0x9a, 0x14, 0x7a, 0x16, 0x9b, 0xe3, 0xc3, 0x83, 0x4c, 0xd8, 0xbe, 0x34, 0x81, 0x2a,
+    0x25, 0x4e, 0x29, 0xcb, 0xd5, 0xcc, 0x82, 0x47, 0xfe, 0x2c, 0x05, 0x3e, 0xf9, 0x5c, 0x2f, 0x4d,
+    0x7e, 0x61, 0x84, 0x1a, 0xad, 0x9e, 0x99, 0x5f, 0xe6, 0x50, 0x59, 0x2d, 0x68, 0x56, 0x9a, 0x24,
+    0xb2, 0xa6, 0x70, 0xa4, 0x6f, 0x6a, 0xb5, 0xfe, 0x6d, 0x59, 0xa4, 0xb1, 0xd6, 0x8a, 0xde, 0x3b,
+    0x09, 0xf9, 0xf7, 0x22, 0x4c, 0x78, 0x19, 0x93, 0x36, 0x6d, 0xbc, 0xf5, 0x26, 0x57, 0x8e, 0x89,
+    0x9f, 0xb2, 0x9e, 0xb2, 0x8e, 0x79, 0x78, 0x58, 0x7e, 0x6f, 0x8d, 0xf4, 0x2d, 0x2d, 0x76, 0xf6,
+    0xdf, 0xcf, 0x4b, 0x50, 0xfc, 0x58, 0x05, 0x88, 0xa1, 0xb5, 0x4c, 0x77, 0x57, 0x53, 0x0e, 0x0f,
+    0x75, 0xe5, 0x0e, 0x5e, 0x55, 0x19, 0x42, 0x36, 0x9a, 0xd9, 0x40, 0x1c, 0xc4, 0x25, 0xb2, 0x7f,
+    0x78, 0xf8, 0x28, 0xe7, 0xd7, 0x5e, 0xe7, 0xbb, 0x0d, 0xed, 0x59, 0xde, 0x0a, 0x00, 0x0a, 0x27,
+    0x12, 0x9c, 0x5a, 0xcc, 0x52, 0xf6, 0x7f, 0xa5, 0xdb, 0xd5, 0x57, 0xbf, 0x36, 0xbc, 0x00, 0x0a,
+    0x41, 0xf9, 0x18, 0xda, 0xe8, 0x9e, 0x5e, 0x50, 0x20, 0x16, 0x3c, 0xe3, 0x16, 0x76, 0x65, 0x2b,
+    0xc1, 0x61, 0xad, 0x3c, 0x40, 0xa9, 0x10, 0x56, 0x6d, 0x84, 0x7e, 0x64, 0x81, 0x8c, 0x53, 0x57,
+    0xf5, 0x93, 0x0d, 0x23, 0x33, 0xc5, 0x45, 0xf5, 0x36, 0x2f, 0xa5, 0xc8, 0x45, 0x59, 0x59, 0x8b,
+    0xa5, 0x72, 0x2f, 0x33, 0x0f, 0xd5, 0x14, 0xe3, 0xa3, 0x5c, 0xae, 0xb4, 0xf0, 0x07, 0x35, 0xb1,
+    0x4a, 0x1d, 0x33, 0xd7, 0x33, 0x76, 0xfe, 0x48, 0xc1, 0x1e, 0xd1, 0xb9, 0x5c, 0x5e, 0x67, 0x78,
+    0xe9, 0x9f, 0x21, 0xb6, 0xe0, 0xfb, 0xd4, 0xb2, 0x61, 0x37, 0x1b, 0xe0, 0x5e, 0x65, 0x0a, 0xd5,
+    0xdc, 0x82, 0x2b, 0xdf, 0x25, 0x7d, 0xe8, 0x99, 0xea, 0x11, 0xa4, 0xbc, 0x47, 0x60, 0xf8, 0x51,
+    0x38, 0x5e, 0x24, 0x72, 0x7d, 0xd6, 0x62, 0x19, 0x87, 0x54, 0xdf, 0x95, 0xd3, 0xa2, 0x2c, 0xce,
+    0xc0, 0x00, 0x8a, 0x55, 0x4c, 0x3e, 0x2c, 0x33, 0x5c, 0xd0, 0xd9, 0x6f, 0x83, 0xf5, 0x17, 0x09,
+    0x60, 0x95, 0xc6, 0x33, 0x3b, 0xa6, 0xab, 0xb4, 0xfa, 0x4b, 0x8f, 0x4f, 0x96, 0xe2, 0xd9, 0x4a,
+    0x3f, 0xbd, 0x69, 0x58, 0x45, 0x63, 0x06, 0x93, 0x23, 0xea, 0x0a, 0xa7, 0x47, 0x1d, 0x95, 0x52,
+    0xfe, 0xc6, 0x81, 0x47, 0xc7, 0xb9, 0xf0, 0x3a, 0x5c, 0xdb, 0xf6, 0xe5, 0xb2, 0x8e, 0x89, 0x6a,
+    0x7b, 0x0d, 0xcf, 0x25, 0x03, 0x98, 0xa5, 0x49, 0xcb, 0x80, 0x1b, 0x8d, 0x2f, 0x81, 0x55, 0xc8,
+    0xed, 0x65, 0xb6, 0x44, 0x7b, 0x12, 0x5d, 0xd3, 0x13, 0x61, 0xf3, 0x71, 0xa7, 0x8b, 0x9f, 0x82,
+    0x6a, 0xde, 0xfd, 0x2b, 0x4c, 0x9a, 0xbe, 0x0d, 0x26, 0x17, 0xed, 0xd9, 0xcb, 0x76, 0x72, 0x1b,
+    0x3b, 0x71, 0x67, 0x51, 0x8e, 0x66, 0xf1, 0x6c, 0xbd, 0xf6, 0x56, 0x75, 0x48, 0x72, 0xb5, 0x41,
+    0xe2, 0xdf, 0xe7, 0xbc, 0xd3, 0x97, 0x54, 0xd2, 0x5c, 0xad, 0xd9, 0x0b, 0x7e, 0x1a, 0xb6, 0x8e,
+    0x3b, 0x67, 0x6e, 0xcd, 0x24, 0xd9, 0xdb, 0x2f, 0x3f, 0x62, 0x92, 0x10, 0x06, 0x5a, 0x58, 0xd1,
+    0x5e, 0x79, 0x6d, 0x77, 0x75, 0x01, 0x23, 0xae, 0x8e, 0x8e, 0xec, 0x75, 0xde, 0x8a, 0x95, 0xf5,
+    0x25, 0xb6, 0x2e, 0xb1, 0x55, 0xcb, 0x0c, 0x9b, 0xcc, 0xe7, 0xd5, 0xed, 0xe7, 0xe5, 0xed, 0x25,
+    0x70, 0xd6, 0x1e, 0x8d, 0x86, 0xe7, 0xb4, 0x2a, 0xeb, 0xe3, 0x47, 0xcf, 0xe3, 0xf2, 0x09, 0x9d,
+    0xb5, 0xb3, 0xe2, 0xbf, 0x85, 0x9f, 0x68, 0x7b, 0x04, 0xb9, 0x31, 0x53, 0x12, 0x17, 0xf5, 0x83,
+    0x77, 0xe4, 0x0e, 0x86, 0x03, 0xbb, 0x38, 0x76, 0x42, 0x7a, 0xa8, 0x63, 0xaf, 0xef, 0xe3, 0xe4,
+    0x0b, 0x28, 0x38, 0x0e, 0x40, 0x55, 0xa4, 0x90, 0x42, 0xe7, 0x0c, 0xfe, 0xd9, 0xae, 0xd0, 0x8f,
+    0xab, 0x40, 0x0d, 0x2c, 0x25, 0x20, 0xc0, 0x08, 0xd1, 0xae, 0x00, 0x3e, 0x26, 0x19, 0x85, 0x7e,
+    0x05, 0xed, 0x02, 0xc5, 0x16, 0xc2, 0xb9, 0x28, 0x9f, 0x09, 0x01, 0x8d, 0x37, 0x0b, 0x21, 0x86,
+    0x20, 0xae, 0xf0, 0xa2, 0x7b, 0x7a, 0xe6, 0x86, 0x28, 0x2f, 0x1e, 0xbe, 0x04, 0x4b, 0x2f, 0x7c,
+    0x72, 0x42, 0xe1, 0x23, 0xe4, 0xde, 0x6b, 0xe7, 0xc9, 0xe8, 0x67, 0xe8, 0x3b, 0x7a, 0x7a, 0x8b,
+    0x56, 0x80, 0x9b, 0xb8, 0xc5, 0xd4, 0x6b, 0xb7, 0x40, 0x7f, 0xcf, 0x9e, 0xe4, 0xfd, 0xb7, 0x47,
+    0xed, 0xd6, 0xb3, 0xce, 0x69, 0xb7, 0x68, 0x38, 0xea, 0x60, 0x53, 0xfb, 0x59, 0x57, 0x68, 0xea,
+    0xde, 0xba, 0x8c, 0xb4, 0x50, 0x89, 0x05, 0x5a, 0x4f, 0x3a, 0xa7, 0xc7, 0xdd, 0xd3, 0x53, 0x56,
+    0xc3, 0xcb, 0xc5, 0xc5, 0x00, 0x3b, 0xa7, 0x4d, 0xfa, 0xc5, 0xdd, 0xc0, 0x1c, 0x8e, 0x3c, 0xfa,
+    0xbd, 0x95, 0xc5, 0xdc, 0x56, 0xe0, 0x24, 0xe7, 0x7e, 0x00, 0x1e, 0x35, 0xc9, 0xac, 0xae, 0x43,
+    0x53, 0x96, 0x0d, 0xb3, 0x6d, 0x38, 0x67, 0x7d, 0xa9, 0xa3, 0x58, 0xa3, 0xa2, 0xce, 0x8e, 0xfb,
+    0xc1, 0xdb, 0x1d, 0x09, 0x7c, 0x6e, 0xdf, 0xd2, 0xcd, 0x86, 0x0f, 0x52, 0x5e, 0x6e, 0x32, 0x63,
+    0x65, 0xf8, 0x5c, 0x0f, 0x0c, 0x7a, 0x56, 0x92, 0x07, 0xef, 0x45, 0xac, 0x5c, 0x24, 0xa7, 0xb0,
+    0xa8, 0x3c, 0x59, 0x29, 0x3c, 0xe9, 0xeb, 0x04, 0xf2, 0xb2, 0x10, 0x13, 0x61, 0x24, 0xee, 0x7e,
+    0x65, 0x12, 0x4b, 0xc5, 0x92, 0x9a, 0xce, 0x36, 0x2d, 0x2c, 0xcf, 0x17, 0xf3, 0x42, 0x92, 0x2d,
+    0x13, 0x09, 0xc8, 0x3c, 0x9b, 0x98, 0x8e, 0x79, 0x62, 0x6e, 0xcf, 0xe8, 0xc6, 0x65, 0x8d, 0xec,
+    0xef, 0x93, 0xd6, 0x15, 0x22, 0x31, 0x58, 0xf8, 0xb2, 0x4f, 0x82, 0x57, 0xe2, 0xcc, 0xc3, 0x21,
+    0xac, 0x21, 0xf9, 0xf1, 0xd9, 0x5e, 0x1d, 0x5b, 0x9a, 0xbc, 0x2f, 0x8b, 0xdf, 0x90, 0xa5, 0x35,
+    0x58, 0x65, 0x65, 0xa4, 0x67, 0x3c, 0x4f, 0x00, 0xbf, 0x35, 0x02, 0xdd, 0xe1, 0x1d, 0xe0, 0xdb,
+    0xe6, 0xd6, 0xc0, 0xeb, 0x0f, 0xb6, 0xee, 0x11, 0xbb, 0xf5, 0x67, 0x1c, 0xce, 0x2c, 0x53, 0x36,
+    0xfd, 0x35, 0xba, 0x98, 0x8f, 0x85, 0xa2, 0xfd, 0x08, 0x3d, 0x61, 0x4a, 0x2c, 0x08, 0x55, 0x61,
+    0x8a, 0x77, 0x18, 0x71, 0xff, 0x09, 0x8a, 0x8f, 0x51, 0x5c, 0xae, 0x31, 0xa8, 0x01, 0x54, 0x63,
+    0x91, 0xc2, 0xaf, 0xf4, 0x91, 0xe6, 0x8b, 0xf8, 0xa5, 0x15, 0xcf, 0x70, 0x10, 0x16, 0x46, 0x96,
+    0x5b, 0x01, 0xa1, 0x99, 0xb5, 0xc3, 0x30, 0x74, 0x2c, 0x42, 0xf1, 0x71, 0x50, 0x83, 0xf3, 0x3e,
+    0x2a, 0x56, 0x8f, 0x0d, 0x4c, 0x9b, 0xd2, 0x64, 0xe8, 0x71, 0xfa, 0x00, 0xbe, 0x88, 0x32, 0x08,
+    0x49, 0x8b, 0xf1, 0x24, 0xe8, 0x02, 0xca, 0x0f, 0x9e, 0xa7, 0x68, 0x2c, 0x61, 0x57, 0xf1, 0x0d,
+    0xb7, 0x41, 0x51, 0x30, 0x96, 0x72, 0xc3, 0xaa, 0x9c, 0xba, 0x0f, 0x01, 0x2d, 0x23, 0xfc, 0x20,
+    0xdb, 0x32, 0xd9, 0x05, 0x37, 0xb3, 0x34, 0xdb, 0x82, 0x0f, 0xf3, 0xc0, 0x13, 0xc9, 0xcd, 0xfc,
+    0x76, 0x1c, 0xb4, 0xcb, 0x63, 0x64, 0x4b, 0x4f, 0x06, 0xac, 0x9c, 0xce, 0x57, 0x5c, 0x0c, 0xab,
+    0xde, 0xa0, 0xa5, 0xc7, 0x6d, 0x5d, 0x44, 0xb7, 0xff, 0xdf, 0x6e, 0x86, 0xdf, 0x7c, 0x41, 0x2d,
+    0x64, 0x06, 0x2b, 0x9c, 0x65, 0xe7, 0x54, 0x3f, 0xad, 0xa7, 0xdd, 0xc2, 0xa0, 0x51, 0x27, 0xec,
+    0x09, 0x6a, 0xbb, 0x66, 0xc1, 0x4a, 0xaf, 0x73, 0xb6, 0x71, 0x70, 0xc1, 0x19, 0x06, 0x52, 0x45,
+    0x27, 0x6c, 0xb5, 0xed, 0x3a, 0xd7, 0x8f, 0x2d, 0xb0, 0xe3, 0xa1, 0x4d, 0x1f, 0x04, 0x94, 0x4e,
+    0xcd, 0x5a, 0x3d, 0xe9, 0x9c, 0x1d, 0x2d, 0x6d, 0xf0, 0x6d, 0xac, 0xd1, 0xf7, 0x04, 0xa7, 0xc6,
+    0xfc, 0x5d, 0x98, 0x31, 0x6f, 0xe7, 0x97, 0x3e, 0x2e, 0x29, 0xa0, 0x6e, 0x39, 0xde, 0xd8, 0x13,
+    0x7c, 0x5b, 0x3e, 0x61, 0x4f, 0x74, 0x6e, 0x15, 0xef, 0x98, 0xe4, 0x5e, 0x71, 0x9c, 0xfb, 0xc2,
+    0x81, 0x8b, 0x83, 0x01, 0x48, 0xbf, 0x58, 0xba, 0xcb, 0x0e, 0xbe, 0xad, 0x27, 0xba, 0x3e, 0x84,
+    0x08, 0xb3, 0xcb, 0x76, 0x0f, 0xc2, 0x5a, 0x9c, 0xa4, 0x05, 0x3f, 0x2e, 0x2e, 0x3a, 0xf6, 0x03,
+    0xb4, 0xba, 0x62, 0x24, 0x83, 0x60, 0xee, 0x86, 0x4a, 0xfd, 0xf3, 0xea, 0x49, 0xf7, 0x96, 0x42,
+    0xf6, 0xfb, 0xe7, 0xf6, 0x61, 0x7b, 0xf9, 0xfa, 0xb5, 0x5b, 0x74, 0x00, 0xc3, 0x1e, 0xf4, 0xb0,
+    0xd6, 0xdc, 0x43, 0xae, 0x69, 0xb7, 0xc3, 0xe8, 0x81, 0xf1, 0x5e, 0xf6, 0x44, 0x1b, 0xb3, 0xa9,
+    0x7a, 0x4f, 0xdc, 0x2a, 0x5c, 0x01, 0xe9, 0xb6, 0xd1, 0x68, 0xdf, 0xbe, 0x0e, 0x2e, 0x67, 0x81,
+    0x1d, 0xc5, 0xa0, 0xfa, 0xb5, 0x5a, 0xad, 0xfd, 0x34, 0x5c, 0xc3, 0x18, 0xf8, 0x2f, 0x21, 0xce,
+    0xa5, 0x29, 0x03, 0x08, 0x13, 0x7e, 0x4a, 0xb9, 0x8f, 0x14, 0x1d, 0xef, 0x99, 0x01, 0xc9, 0x27,
+    0xd7, 0xc5, 0xb9, 0x74, 0xdb, 0x29, 0xce, 0xaa, 0xe9, 0x38, 0x0e, 0xa5, 0xd0, 0xec, 0xd8, 0x65,
+    0x9e, 0x22, 0x5d, 0xfc, 0xc8, 0x4f, 0xa7, 0xeb, 0x52, 0x34, 0x57, 0x08, 0x44, 0x44, 0x36, 0x3e,
+    0x73, 0xc4, 0x5b, 0x57, 0x1f, 0xcd, 0x23, 0xc2, 0xe1, 0x21, 0xfe, 0x6c, 0xe1, 0xf3, 0x65, 0xf1,
+    0xad, 0xf7, 0x07, 0xbb, 0x09, 0xfc, 0x8f, 0x35, 0xa7, 0x70, 0xd4, 0xd9, 0xfc, 0x51, 0x5e, 0x6f,
+    0xc3, 0x1b, 0x27, 0x47, 0x47, 0x9a, 0x7b, 0x28, 0xee, 0xd7, 0x44, 0x29, 0x34, 0x3d, 0x04, 0xa4,
+    0x47, 0x9e, 0xa7, 0x21, 0x95, 0x8b, 0x58, 0x73, 0xa5, 0x05, 0x48, 0xcb, 0x13, 0xca, 0xcd, 0xbf,
+    0xe8, 0x47, 0xf7, 0xa3, 0xbe, 0xdd, 0xdb, 0x9a, 0xf9, 0x2d, 0xe0, 0x7a, 0xbf, 0x8a, 0x46, 0x90,
+    0x6a, 0x5c, 0x2e, 0x5b, 0x98, 0x23, 0xee, 0x82, 0x09, 0x6a, 0x4f, 0xed, 0x7a, 0xd1, 0x52, 0x0c,
+    0x59, 0x3e, 0x3c, 0xc0, 0x0f, 0xae, 0x2b, 0xc0, 0xe7, 0xd9, 0x09, 0xaf, 0xb3, 0x14, 0xe9, 0x9f,
+    0xbb, 0x7f, 0x16, 0x96, 0xc7, 0x89, 0x3f, 0xdc, 0x54, 0x72, 0x7b, 0x06, 0x76, 0x64, 0x8e, 0x7f,
+    0xef, 0xe5, 0x2d, 0xb8, 0x2f, 0xe4, 0x3a, 0x85, 0x90, 0x8c, 0x80, 0x71, 0x3c, 0x81, 0xf4, 0xe6,
+    0xe4, 0xe8, 0xc4, 0xa6, 0x96, 0x1f, 0xe6, 0x55, 0x5c, 0xcf, 0xf8, 0xe0, 0x7f, 0x40, 0x73, 0x62,
+    0xff, 0x80, 0x39, 0xd5, 0x24, 0x6a, 0xa2, 0x25, 0x63, 0x96, 0xcb, 0x82, 0x80, 0x7f, 0x69, 0xdb,
+    0x87, 0x60, 0xf8, 0x36, 0x9a, 0x5c, 0xb4, 0x6e, 0x68, 0x76, 0xc3, 0xc9, 0x18, 0xf1, 0x5b, 0x86,
+    0x6a, 0xed, 0x98, 0x85, 0x69, 0x68, 0xa9, 0x1d, 0xcc, 0x0e, 0x53, 0x92, 0xdc, 0xe5, 0x34, 0xa4,
+    0x3a, 0xa1, 0x78, 0xbf, 0x0a, 0xa1, 0xd9, 0x4d, 0xa7, 0xca, 0x9d, 0xe5, 0x8f, 0xfc, 0xbe, 0xc2,
+    0x0f, 0xbf, 0xec, 0x54, 0xb9, 0x4e, 0x55, 0x19, 0xd3, 0x76, 0xff, 0xfa, 0x3b, 0x5d, 0x3c, 0xeb,
+    0x3b, 0x3c, 0xa4, 0xf1, 0x30, 0xc6, 0x22, 0xc2, 0xd7, 0x16, 0x7b, 0x6f, 0x71, 0x2d, 0x5d, 0x94,
+    0xf5, 0x94, 0x6e, 0x88, 0x3e, 0xe7, 0x0f, 0x0f, 0xeb, 0x4d, 0xe5, 0x3e, 0x6c, 0x05, 0x90, 0x75,
+    0x51, 0xd8, 0xea, 0x01, 0x9c, 0xc7, 0xc9, 0x97, 0x87, 0x5f, 0x6e, 0xe5, 0xe0, 0xad, 0x80, 0x29,
+    0x8e, 0x2f, 0x01, 0x8e, 0xde, 0xde, 0x74, 0xab, 0x67, 0x6e, 0x05, 0xf0, 0x48, 0x3c, 0x02, 0xe3,
+    0x55, 0x3a, 0x6d, 0x5f, 0xf1, 0xfe, 0xbb, 0xca, 0x5a, 0x39, 0x27, 0x81, 0x3b, 0xdd, 0x09, 0x9c,
+    0x08, 0x59, 0xe5, 0x51, 0x7b, 0xf8, 0x26, 0xa2, 0xe8, 0x38, 0xad, 0xeb, 0x06, 0x66, 0xd5, 0xd3,
+    0x0e, 0x51, 0xe0, 0xb4, 0x39, 0x3f, 0xfe, 0xe0, 0xf5, 0x32, 0x8d, 0xd0, 0xb5, 0x52, 0xae, 0x17,
+    0x69, 0x9d, 0x80, 0xea, 0xc4, 0xb1, 0x75, 0xe2, 0x9a, 0x09, 0xe4, 0xec, 0xea, 0x0f, 0x81, 0xaa,
+    0x87, 0x91, 0xb2, 0xf6, 0x32, 0x45, 0xb7, 0xd7, 0xe5, 0x25, 0x64, 0x51, 0x2e, 0xf9, 0x36, 0x10,
+    0x85, 0xe8, 0x16, 0x37, 0x8f, 0x8b, 0x0b, 0x17, 0x8f, 0x1e, 0x89, 0xd0, 0x11, 0x74, 0xb9, 0xe2,
+    0x35, 0x63, 0xa9, 0x6c, 0xfb, 0xc7, 0x3f, 0xd6, 0x22, 0x30, 0xad, 0xef, 0x6f, 0x98, 0x61, 0xb2,
+    0x52, 0x9b, 0xba, 0x52, 0x12, 0x18, 0x96, 0x0c, 0xb5, 0x98, 0x85, 0xff, 0x5e, 0x90, 0x8d, 0xc1,
+    0x7e, 0xdb, 0x7f, 0x88, 0xa5, 0x73, 0xdd, 0x20, 0x66, 0x5b, 0xa5, 0x68, 0x6a, 0xd8, 0x66, 0xb7,
+    0x40, 0x36, 0xe5, 0xbd, 0xf0, 0xdf, 0x8a, 0x99, 0x73, 0xe9, 0xa8, 0x37, 0x06, 0xd8, 0xef, 0x1e,
+    0xbf, 0x42, 0x5a, 0xbd, 0xdb, 0x40, 0x09, 0xb8, 0x9a, 0x5b, 0x2d, 0xec, 0x14, 0xae, 0x7a, 0xa7,
+    0x41, 0x19, 0xeb, 0xb2, 0xf8, 0xc6, 0xc7, 0x28, 0xaa, 0x97, 0xa2, 0x49, 0x2e, 0x6b, 0xcd, 0xea,
+    0x2d, 0x58, 0xf5, 0xa6, 0x6d, 0xcd, 0x25, 0x5b, 0x4d, 0xb8, 0x70, 0x74, 0xe4, 0x6e, 0xf3, 0xe5,
+    0x5a, 0xa3, 0x6a, 0xaf, 0xeb, 0x62, 0x03, 0x3d, 0x38, 0x5f, 0xb5, 0x6f, 0x76, 0x96, 0x1b, 0x8e,
+    0x5f, 0xc7, 0xe7, 0xa6, 0xee, 0x68, 0x82, 0x47, 0x4f, 0x52, 0x9d, 0xbf, 0x14, 0x1d, 0x6d, 0xff,
+    0x0b, 0x27, 0x58, 0xb2, 0x2d, 0x5e, 0x95, 0xcf, 0x6f, 0x80, 0xea, 0xce, 0x58, 0x8a, 0xa3, 0x57,
+    0x76, 0x27, 0x5e, 0x53, 0x9a, 0xca, 0xe3, 0x61, 0xfa, 0x66, 0x41, 0x25, 0x2d, 0xa8, 0xce, 0xb1,
+    0x9a, 0x25, 0xb8, 0x62, 0xf4, 0x40, 0xe9, 0xb4, 0xf2, 0x18, 0xa2, 0x2e, 0xd6, 0xd6, 0x69, 0xd3,
+    0x77, 0x04, 0xde, 0xfa, 0x83, 0x0c, 0x8c, 0xc2, 0xab, 0x77, 0x58, 0x26, 0xfe, 0x2c, 0x88, 0x68,
+    0xad, 0x91, 0x81, 0x87, 0x58, 0xe8, 0x5a, 0x4b, 0xea, 0x2e, 0x44, 0x82, 0x6a, 0x61, 0xf2, 0xe1,
+    0xe1, 0xf3, 0xad, 0xfd, 0x75, 0x9b, 0xa1, 0x2e, 0x2d, 0xaa, 0xdd, 0x7a, 0xff, 0xfd, 0xbb, 0x47,
+    0x7b, 0x44, 0x2c, 0x9e, 0xa9, 0xf6, 0x30, 0xf8, 0xdf, 0x48, 0x81, 0xb6, 0x7e, 0x4a, 0x2c, 0xeb,
+    0xd1, 0x25, 0x95, 0x6d, 0xc8, 0x2e, 0xb6, 0x9e, 0x44, 0xd3, 0x31, 0x1c, 0xdd, 0xa8, 0x95, 0x35,
+    0x97, 0x4b, 0x88, 0xc2, 0xdd, 0x25, 0x7d, 0xd9, 0x15, 0x6f, 0x9b, 0x13, 0x53, 0xac, 0x7e, 0x56,
+    0x6a, 0x9e, 0xf4, 0x35, 0x3d, 0x62, 0xc8, 0xf5, 0xcd, 0x6d, 0x95, 0xd4, 0xe2, 0xc5, 0x0d, 0x29,
+    0x22, 0xae, 0xaa, 0x00, 0xa4, 0x36, 0xa8, 0x04, 0x0f, 0x0f, 0xf5, 0x87, 0xe3, 0xbb, 0xe2, 0xec,
+    0xcd, 0xd7, 0x14, 0x49, 0xcd, 0xd7, 0x94, 0x7b, 0xbc, 0x9a, 0xc6, 0xa5, 0x64, 0xb0, 0xe9, 0x97,
+    0xf9, 0x9b, 0x22, 0x4c, 0xf9, 0x50, 0xfa, 0xc7, 0x9e, 0xf8, 0x6f, 0x2d, 0xc3, 0xe3, 0xb2, 0xc1,
+    0x92, 0x94, 0x87, 0xf5, 0x7f, 0x99, 0x1d, 0xa4, 0x1e, 0x0f, 0x13, 0xa9, 0xd2, 0x7e, 0x19, 0xf1,
+    0xc8, 0x50, 0xb9, 0x2f, 0x0e, 0x35, 0x72, 0x73, 0x99, 0xeb, 0xd2, 0xce, 0xe2, 0x8d, 0xcb, 0x86,
+    0x69, 0xcd, 0x17, 0xe9, 0xc4, 0x2a, 0xd0, 0x5b, 0x13, 0xba, 0x39, 0x61, 0x8e, 0xbc, 0x9b, 0xff,
+    0x2d, 0x04, 0xcf, 0x6b, 0xcb, 0x87, 0x20, 0x1f, 0xf8, 0x2d, 0xc3, 0x14, 0x97, 0x8d, 0xad, 0x87,
+    0x7a, 0x04, 0x22, 0x1e, 0x37, 0x30, 0x6a, 0xa6, 0xc3, 0xa9, 0xb2, 0x8a, 0xb4, 0x63, 0xda, 0xc5,
+    0xbd, 0x01, 0xd0, 0x73, 0x31, 0x67, 0x79, 0x78, 0x78, 0xa4, 0x49, 0x61, 0xa0, 0x75, 0xe7, 0xed,
+    0x8a, 0xf2, 0x62, 0x44, 0x95, 0x81, 0xf2, 0x1a, 0x9c, 0x1a, 0x21, 0xea, 0x6e, 0xc0, 0xe1, 0xeb,
+    0x68, 0x4e, 0x25, 0xd0, 0xba, 0x34, 0x3b, 0x10, 0x33, 0xb5, 0x77, 0x1c, 0x9b, 0x84, 0xfc, 0xb6,
+    0xf1, 0xdf, 0xe9, 0x2a, 0xdc, 0xbe, 0x27, 0x25, 0xfc, 0x0f, 0x23, 0xfc, 0x05, 0x97, 0xe1, 0xf4,
+    0x87, 0x22, 0xf9, 0xbb, 0xbd, 0x2d, 0x3f, 0x08, 0xae, 0xee, 0x40, 0x68, 0xef, 0xc2, 0x14, 0x64,
+    0x47, 0xd0, 0x04, 0x2e, 0x06, 0xd3, 0x30, 0x33, 0x1d, 0xe2, 0xf5, 0xd7, 0x84, 0xfe, 0xb5, 0x41,
+    0xea, 0x6a, 0x46, 0xfe, 0x22, 0xc2, 0x0b, 0x67, 0x9a, 0xdb, 0x73, 0x9c, 0xaa, 0xed, 0x1e, 0x08,
+    0xc9, 0x44, 0x95, 0x30, 0xbb, 0xc5, 0x6a, 0xd2, 0xd2, 0xcb, 0x7a, 0xdf, 0x64, 0x64, 0xfb, 0x70,
+    0x62, 0xee, 0x55, 0x1d, 0x90, 0xbe, 0x3a, 0xcf, 0xc6, 0xd3, 0x90, 0x81, 0x7d, 0xb2, 0x03, 0x5f,
+    0x64, 0xb8, 0x8e, 0x8f, 0x92, 0x0b, 0x9a, 0xa1, 0x7d, 0x2f, 0x11, 0xb6, 0x7d, 0xbe, 0x7d, 0x2a,
+    0x75, 0xf8, 0x7b, 0x72, 0xa1, 0x26, 0xa2, 0xdf, 0xc0, 0xc8, 0x6e, 0x12, 0x5f, 0xcd, 0xcb, 0xf7,
+    0x49, 0x56, 0xcd, 0x93, 0xbf, 0x6b, 0x4e, 0xdf, 0x29, 0x5f, 0x30, 0x22, 0xc2, 0x8b, 0x0b, 0x6b,
+    0xe1, 0xd5, 0x84, 0x1d, 0xdb, 0x05, 0x10, 0xab, 0x6f, 0x29, 0xc8, 0x25, 0xf8, 0x80, 0xa4, 0x10,
+    0x31, 0x05, 0x45, 0xaa, 0x29, 0xbf, 0xf3, 0xa0, 0xa6, 0xa6, 0xc2, 0x1b, 0xa7, 0xf1, 0x82, 0xd2,
+    0xf4, 0xa4, 0x6c, 0x55, 0x93, 0x89, 0x96, 0xf4, 0x6d, 0xb7, 0x78, 0xe3, 0x41, 0x68, 0x75, 0x44,
+    0x6a, 0xfc, 0x40, 0x50, 0x7d, 0x19, 0x65, 0xab, 0xf0, 0xd7, 0x35, 0x2f, 0xf3, 0xb9, 0xb5, 0xaf,
+    0xf8, 0xb0, 0xdb, 0xba, 0x38, 0xd4, 0xee, 0x81, 0x24, 0x79, 0x7e, 0xf5, 0x48, 0x85, 0xd1, 0x11,
+    0xa2, 0x85, 0xfa, 0x31, 0x34, 0xd9, 0x08, 0xc7, 0x2c, 0x03, 0x98, 0x7d, 0x44, 0xa1, 0xde, 0xc5,
+    0xd3, 0xd7, 0xfc, 0xf7, 0x8e, 0xdb, 0x37, 0x7b, 0x30, 0xa1, 0x11, 0xd3, 0x8f, 0xe4, 0xc2, 0x91,
+    0x03, 0x7d, 0x81, 0x29, 0x1e, 0xb7, 0xed, 0xc5, 0xd1, 0x0f, 0x1e, 0xfa, 0x2b, 0x0c, 0x83, 0x38,
+    0x84, 0xbd, 0x03, 0x5d, 0x67, 0x14, 0xb6, 0x24, 0x3d, 0x9b, 0x9c, 0x1e, 0x0d, 0x8d, 0x7e, 0x0c,
+    0xb9, 0xe2, 0x8e, 0x25, 0xbf, 0xb6, 0xa8, 0x5c, 0xef, 0xdb, 0xae, 0x83, 0x7b, 0x9d, 0xfc, 0xe1,
+    0x01, 0xb1, 0x70, 0x19, 0x89, 0xc7, 0x92, 0x9a, 0x9b, 0x81, 0xb6, 0xdd, 0xec, 0x54, 0x4e, 0x47,
+    0x00, 0xdb, 0x86, 0xa4, 0x08, 0x68, 0x14, 0x67, 0x54, 0x52, 0xfa, 0x5d, 0xbc, 0xdc, 0xa5, 0x3b,
+    0x9f, 0x0c, 0x96, 0x74, 0x09, 0x77, 0x4d, 0x49, 0x35, 0xa4, 0x7f, 0x87, 0x39, 0x6d, 0x0e, 0x6a,
+    0x5f, 0xfe, 0x57, 0xfe, 0x78, 0x91, 0x69, 0xeb, 0xa6, 0x0c, 0x81, 0xef, 0x17, 0xd3, 0x91, 0x2e,
+    0x6b, 0x81, 0xfb, 0xa9, 0xd9, 0xce, 0xf5, 0x63, 0x95, 0x7f, 0x01, 0x07, 0x86, 0x91, 0xee, 0xd6,
+    0xc6, 0x2c, 0xb0, 0x6e, 0x4d, 0xa0, 0xcf, 0x3d, 0x10, 0x72, 0x57, 0x4c, 0x73, 0x2b, 0xb9, 0x6b,
+    0x8f, 0x9d, 0x11, 0xc1, 0x50, 0x4a, 0x5c, 0x8b, 0x7f, 0x87, 0x92, 0xff, 0x29, 0x9d, 0x8b, 0x63,
+    0xfe, 0x57, 0x56, 0x8f, 0xe9, 0xff, 0xbc, 0xf0, 0x7f, 0xd7, 0x11, 0x7a, 0x08, 0x89, 0x61, 0x00,
+    0x00,
+};
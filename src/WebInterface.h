@@ -3,16 +3,27 @@
 #include <stdint.h>
 
 #include <WebServer.h>
+#include <WebSocketsServer.h>
+#include <WiFiUdp.h>
+#include <array>
 #include <vector>
 #include <string>
 
 #include "AnimatedImage.h"
 #include "AnimatedText.h"
+#include "GrayscaleMatrix.h"
+#include "LiveFrameBuffer.h"
+#include "ScanBuffer.h"
+#include "ScanStats.h"
+#include "StateJson.h"
+#include "UdpFrameReceiver.h"
 
 enum class DisplayMode
 {
     Text,
-    Image
+    Image,
+    Grayscale, // still picture with per-pixel levels, scanned with BCM
+    Live    // frames streamed over the WebSocket (LiveFrameBuffer) or UDP (UdpFrameReceiver)
 };
 
 enum class TextLayout
@@ -28,15 +39,24 @@ class WebInterface
 public:
     WebInterface(AnimatedText& animatedTextTop,
                  AnimatedText& animatedTextBottom,
-                 AnimatedImage& animatedImage);
+                 AnimatedImage& animatedImage,
+                 LiveFrameBuffer& liveFrames,
+                 UdpFrameReceiver& udpFrames,
+                 ScanStats& scanStats);
 
     void begin();
     void handle();
 
     DisplayMode getDisplayMode() const;
+    const GrayscaleMatrix& getGrayscaleFrame() const;
     TextLayout  getTextLayout() const;
     uint16_t    getBrightnessDuty() const;
     uint16_t    getBrightnessScale() const;
+    ScanSchedule getScanSchedule() const;
+    bool         isRowLoadCompensationEnabled() const;
+
+    // incremented whenever an API call changes what should be displayed
+    uint32_t     getRevision() const;
 
 private:
     static constexpr float    kBrightnessGamma      = 2.2f;
@@ -45,32 +65,71 @@ private:
     AnimatedText& mAnimatedTextTop;
     AnimatedText& mAnimatedTextBottom;
     AnimatedImage& mAnimatedImage;
+    LiveFrameBuffer& mLiveFrames;
+    UdpFrameReceiver& mUdpFrames;
+    ScanStats&     mScanStats;
     WebServer      mHttpServer;
+    WebSocketsServer mLiveSocket;
+    WiFiUDP          mLiveUdp;
 
     DisplayMode        mDisplayMode;
     TextLayout         mTextLayout;
-    std::vector<Image> mImageFrames;
+    FrameSequence      mImageFrames;
+    GrayscaleMatrix    mGrayscaleFrame;
     uint16_t           mBrightnessDuty;
     uint8_t            mBrightnessPercent;
+    ScanSchedule       mScanSchedule;
+    bool               mRowLoadCompensation;
+    uint32_t           mRevision;
+    StateJson          mStateJson;   // /api/state payload of some revision
+    bool               mLiveSwitchPending; // a WebSocket client connected, its first frame selects DisplayMode::Live
+
+    // binary upload in progress; frames go into the store as they arrive
+    struct ImageStream
+    {
+        std::shared_ptr<FrameStore> frames;
+        FrameStore::Bytes           pending{};        // bytes of a frame split across chunks
+        size_t                      pendingBytes = 0;
+        size_t                      totalBytes   = 0;
+        bool                        tooLong      = false;
+        uint32_t                    startMs      = 0;
+        uint32_t                    elapsedMs    = 0;
+    };
+    ImageStream        mImageStream;
+
+    std::array<uint8_t, UdpFrameReceiver::kMaxPacketBytes> mUdpPacket{}; // one datagram, see pollLiveUdp()
 
     void updateBrightnessFromPercent(uint8_t percent);
-    String htmlEscape(const std::string& text) const;
+    void markStateChanged();
     String jsonEscape(const std::string& text) const;
     AnimatedText::AnimationMode parseTextMode(const String& arg) const;
+    const char*                 textModeToString(AnimatedText::AnimationMode mode) const;
     const char*                 textLayoutToString(TextLayout layout) const;
     TextLayout                  parseTextLayout(const String& arg) const;
+    const char*                 scanScheduleToString(ScanSchedule schedule) const;
+    bool                        parseScanSchedule(const String& arg, ScanSchedule& out) const;
+    bool                        parseDurationList(const String& arg, std::vector<uint32_t>& out) const;
     bool                        decodeHexFrame(const String& hex, Image& out) const;
-    String                      imageToHexString(const Image& image) const;
-    String                      buildStateJsonPayload();
-    String                      buildHtml();
+    bool                        decodeGrayscaleLevels(const String& hex, GrayscaleMatrix& out) const;
+    void                        captureState(StateJson::Snapshot& snapshot) const;
     void                        sendJsonResponse(int code, bool ok, const String& message);
     void                        sendStateJson();
     void                        applyDisplayMode(DisplayMode mode);
     void                        handleRoot();
     void                        handleApiState();
     void                        handleApiText();
+    void                        handleApiTextAppend();
     void                        handleApiImages();
+    void                        handleApiImagesStream();
+    void                        handleApiImagesStreamData();
+    bool                        applyImageUpdate(std::shared_ptr<FrameStore> newFrames);
+    void                        handleApiGrayscale();
     void                        handleApiBrightness();
     void                        handleApiMode();
+    void                        handleApiScan();
+    void                        handleApiScanStats();
+    void                        handleApiLiveStats();
+    void                        handleLiveSocketEvent(uint8_t client, WStype_t type, uint8_t* payload, size_t length);
+    void                        pollLiveUdp();
     void                        handleNotFound();
 };
@@ -6,14 +6,20 @@
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-#include <freertos/semphr.h>
 #include <esp32-hal-timer.h>
 
 #include "Matrix16x16.h"
 #include "AnimatedText.h"
 #include "AnimatedImage.h"
+#include "LiveFrameBuffer.h"
+#include "UdpFrameReceiver.h"
 #include "WebInterface.h"
 #include "ShiftRegisterChain.h"
+#include "GrayscaleMatrix.h"
+#include "ScanBuffer.h"
+#include "ScanEngine.h"
+#include "FrameExchange.h"
+#include "ScanStats.h"
 
 Backend* gBackend = nullptr;
 
@@ -21,51 +27,87 @@ Backend            backend;
 AnimatedText       animatedTextTop;
 AnimatedText       animatedTextBottom;
 AnimatedImage      animatedImage;
+LiveFrameBuffer    liveFrames;
+UdpFrameReceiver   udpFrames;
 ShiftRegisterChain shiftChain;
-WebInterface       webInterface(animatedTextTop, animatedTextBottom, animatedImage);
+ScanStats          scanStats;
+WebInterface       webInterface(animatedTextTop, animatedTextBottom, animatedImage, liveFrames, udpFrames, scanStats);
 
 namespace
 {
-    hw_timer_t*       gWaitTimer      = nullptr;
-    SemaphoreHandle_t gTimerSemaphore = nullptr;
-    portMUX_TYPE      gTimerMux       = portMUX_INITIALIZER_UNLOCKED;
+    constexpr uint32_t kRowPeriodUs = 520; // 16 rows x 520us ~= 8 ms per frame (~120 Hz refresh)
+
+    hw_timer_t*  gScanTimer         = nullptr;
+    TaskHandle_t gDisplayTaskHandle = nullptr;
+    ScanEngine   gScanEngine;
+    uint64_t     gScanAlarmUs       = 0;
 
-    void IRAM_ATTR waitTimerISR()
+    // advances the row/phase state machine, latches the next word and re-arms itself
+    void IRAM_ATTR scanTimerISR()
     {
-        BaseType_t higherPriorityTaskWoken = pdFALSE;
-        if (gTimerSemaphore != nullptr)
+        ScanEngine::Step step = gScanEngine.step();
+        shiftChain.writeWord(step.word);
+
+        if (step.durationUs == 0)
+        {
+            step.durationUs = kRowPeriodUs;
+        }
+
+        const uint64_t nowUs = timerRead(gScanTimer);
+        scanStats.recordStep(static_cast<uint32_t>(nowUs), step.durationUs, step.rowStart, step.frameStart);
+
+        // schedule relative to the previous alarm so ISR latency does not accumulate
+        gScanAlarmUs += step.durationUs;
+        if (gScanAlarmUs <= nowUs)
         {
-            xSemaphoreGiveFromISR(gTimerSemaphore, &higherPriorityTaskWoken);
+            scanStats.recordDeadlineMiss();
+            gScanAlarmUs = nowUs + step.durationUs;
         }
-        if (higherPriorityTaskWoken == pdTRUE)
+        timerAlarmWrite(gScanTimer, gScanAlarmUs, false);
+        timerAlarmEnable(gScanTimer);
+
+        if (step.frameStart && gDisplayTaskHandle != nullptr)
         {
-            portYIELD_FROM_ISR();
+            BaseType_t higherPriorityTaskWoken = pdFALSE;
+            vTaskNotifyGiveFromISR(gDisplayTaskHandle, &higherPriorityTaskWoken);
+            if (higherPriorityTaskWoken == pdTRUE)
+            {
+                portYIELD_FROM_ISR();
+            }
         }
     }
 }
 
-static struct FrameData
+struct FrameData
 {
-    Matrix16x16 matrix;
-    uint16_t    brightnessDuty  = 0;
-    uint16_t    brightnessScale = 0;
-} frameData;
-
-portMUX_TYPE frameDataLock = portMUX_INITIALIZER_UNLOCKED;
-
-static void updateFrameData(const Matrix16x16& newFrame)
+    Matrix16x16     matrix;
+    GrayscaleMatrix grayscale;
+    bool            grayscaleActive     = false; // scan `grayscale` with BCM instead of `matrix`
+    uint16_t        brightnessDuty      = 0;
+    uint16_t        brightnessScale     = 0;
+    ScanSchedule    scanSchedule        = ScanSchedule::AllRows;
+    bool            rowLoadCompensation = ROW_LOAD_COMPENSATION_ENABLED;
+};
+
+// web task (producer) -> display task (consumer)
+static FrameExchange<FrameData> frameExchange;
+
+// the caller has already written the pixels into frameExchange.writeBuffer(),
+// into `grayscale` if `grayscaleActive` is set and into `matrix` otherwise
+static void publishFrameData(bool grayscaleActive)
 {
-    const uint16_t brightnessDuty  = webInterface.getBrightnessDuty();
-    const uint16_t brightnessScale = webInterface.getBrightnessScale();
-
-    portENTER_CRITICAL(&frameDataLock);
-    frameData.matrix          = newFrame;
-    frameData.brightnessDuty  = brightnessDuty;
-    frameData.brightnessScale = brightnessScale;
-    portEXIT_CRITICAL(&frameDataLock);
+    FrameData& frame = frameExchange.writeBuffer();
+    frame.grayscaleActive     = grayscaleActive;
+    frame.brightnessDuty      = webInterface.getBrightnessDuty();
+    frame.brightnessScale     = webInterface.getBrightnessScale();
+    frame.scanSchedule        = webInterface.getScanSchedule();
+    frame.rowLoadCompensation = webInterface.isRowLoadCompensationEnabled();
+    frameExchange.publish();
 }
 
-static Matrix16x16 composeTextFrame(uint32_t nowMs)
+// writes the text frame into `target` when either line changed (or `force` is set);
+// returns false and leaves `target` untouched otherwise
+static bool composeTextFrame(Matrix16x16& target, uint32_t nowMs, bool force)
 {
     const TextLayout layout = webInterface.getTextLayout();
     static TextLayout appliedLayout = TextLayout::Dual;
@@ -96,24 +138,75 @@ static Matrix16x16 composeTextFrame(uint32_t nowMs)
         appliedLayout = layout;
     }
 
-    Matrix16x16 topFrame    = animatedTextTop.update(nowMs);
-    Matrix16x16 bottomFrame = animatedTextBottom.update(nowMs);
+    // last frame of each line, refreshed only when the line changed
+    static Matrix16x16 topFrame;
+    static Matrix16x16 bottomFrame;
+
+    const bool topChanged    = animatedTextTop.render(topFrame, nowMs);
+    const bool bottomChanged = animatedTextBottom.render(bottomFrame, nowMs);
+    if (!topChanged && !bottomChanged && !force)
+        return false;
 
     switch (layout)
     {
-        case TextLayout::Dual:
-            topFrame.merge(bottomFrame);
-            return topFrame;
         case TextLayout::SingleTop:
-            return topFrame;
-        case TextLayout::SingleBottom:
-            return bottomFrame;
         case TextLayout::Center:
-            return topFrame;
+            target.copyFrom(topFrame);
+            break;
+        case TextLayout::SingleBottom:
+            target.copyFrom(bottomFrame);
+            break;
+        case TextLayout::Dual:
         default:
-            topFrame.merge(bottomFrame);
-            return topFrame;
+            target.copyFrom(topFrame);
+            target.merge(bottomFrame);
+            break;
     }
+    return true;
+}
+
+// unconditional text frame, used while setup() reports the connection progress
+static void publishTextFrame(uint32_t nowMs)
+{
+    composeTextFrame(frameExchange.writeBuffer().matrix, nowMs, true);
+    publishFrameData(false);
+}
+
+// same contract as composeTextFrame()
+static bool composeImageFrame(Matrix16x16& target, uint32_t nowMs, bool force)
+{
+    static Matrix16x16 imageFrame;
+
+    if (!animatedImage.render(imageFrame, nowMs) && !force)
+        return false;
+
+    target.copyFrom(imageFrame);
+    return true;
+}
+
+// the grayscale picture is static, so it is only copied when the state changed
+static bool composeGrayscaleFrame(GrayscaleMatrix& target, bool force)
+{
+    if (!force)
+        return false;
+
+    target = webInterface.getGrayscaleFrame();
+    return true;
+}
+
+// same contract as composeTextFrame(); between live frames the last one stays up.
+// A UDP frame is newer than anything the jitter buffer plays out, so it wins.
+static bool composeLiveFrame(Matrix16x16& target, uint32_t nowMs, bool force)
+{
+    static Matrix16x16 liveFrame;
+
+    const bool streamed = liveFrames.render(liveFrame, nowMs);
+    const bool datagram = udpFrames.takeFrame(liveFrame);
+    if (!streamed && !datagram && !force)
+        return false;
+
+    target.copyFrom(liveFrame);
+    return true;
 }
 
 // pin display- and webserver tasks to different cores chips with more than one core
@@ -125,162 +218,156 @@ constexpr BaseType_t kDisplayTaskCore = tskNO_AFFINITY;
 constexpr BaseType_t kWebTaskCore     = tskNO_AFFINITY;
 #endif
 
-static void waitWithHardwareTimer(uint32_t microseconds)
+static void startScanTimer()
 {
-    if (microseconds == 0)
-        return;
+    constexpr uint8_t  kTimerNumber  = 0;
+    constexpr uint16_t kTimerDivider = 80; // 80 MHz / 80 = 1 tick per microsecond
 
-    if (gTimerSemaphore == nullptr)
-    {
-        gTimerSemaphore = xSemaphoreCreateBinary();
-        configASSERT(gTimerSemaphore != nullptr);
-    }
-
-    if (gWaitTimer == nullptr)
-    {
-        constexpr uint8_t  kTimerNumber   = 0;
-        constexpr uint16_t kTimerDivider  = 80; // 80 MHz / 80 = 1 tick per microsecond
-        gWaitTimer = timerBegin(kTimerNumber, kTimerDivider, true);
-        configASSERT(gWaitTimer != nullptr);
-        timerAttachInterrupt(gWaitTimer, &waitTimerISR, true);
-    }
+    // the ISR writes to the shift registers directly, so keep the SPI transaction open
+    shiftChain.claimBus();
 
-    // ensure semaphore starts in the empty state before arming the timer
-    xSemaphoreTake(gTimerSemaphore, 0);
+    // the interrupt is routed to the core calling timerAttachInterrupt (the display core)
+    gScanTimer = timerBegin(kTimerNumber, kTimerDivider, true);
+    configASSERT(gScanTimer != nullptr);
+    timerAttachInterrupt(gScanTimer, &scanTimerISR, true);
 
-    portENTER_CRITICAL(&gTimerMux);
-    timerAlarmDisable(gWaitTimer);
-    timerStop(gWaitTimer);
-    timerWrite(gWaitTimer, 0);
-    timerAlarmWrite(gWaitTimer, microseconds, false);
-    timerAlarmEnable(gWaitTimer);
-    timerStart(gWaitTimer);
-    portEXIT_CRITICAL(&gTimerMux);
-
-    // block until the hardware timer fires
-    xSemaphoreTake(gTimerSemaphore, portMAX_DELAY);
+    timerWrite(gScanTimer, 0);
+    gScanAlarmUs = kRowPeriodUs;
+    timerAlarmWrite(gScanTimer, gScanAlarmUs, false);
+    timerAlarmEnable(gScanTimer);
 }
 
 void displayTask(void* param)
 {
     (void)param;
 
-    int row = 0;
-    constexpr uint32_t kRowPeriodUs = 520; // 16 rows x 520us ~= 8 ms per frame (~120 Hz refresh)
-
-    FrameData displayFrame;
-    portENTER_CRITICAL(&frameDataLock);
-    displayFrame = frameData;
-    portEXIT_CRITICAL(&frameDataLock);
-
-    uint32_t brightnessScale = displayFrame.brightnessScale;
-    uint16_t brightnessDuty  = displayFrame.brightnessDuty;
-    uint32_t rowOnTimeUs     = 0;
-    uint32_t rowOffTimeUs    = kRowPeriodUs;
-
-    auto updateBrightnessTiming = [&]() 
+    // build the newest published frame into the engine's back buffer; the ISR adopts it at the next frame start
+    auto prepareFrame = [&]()
     {
-        // zero brightness
-        if (brightnessScale == 0 || brightnessDuty == 0)
-        {
-            rowOnTimeUs  = 0;
-            rowOffTimeUs = kRowPeriodUs;
+        if (!frameExchange.acquire())
             return;
-        }
 
-        // full brightness
-        if (brightnessDuty >= brightnessScale)
+        const FrameData& displayFrame = frameExchange.readBuffer();
+        ScanBuffer&      scanBuffer   = gScanEngine.backBuffer();
+        scanBuffer.setSchedule(displayFrame.scanSchedule);
+        scanBuffer.setRowLoadCompensation(displayFrame.rowLoadCompensation);
+        if (displayFrame.grayscaleActive)
         {
-            rowOnTimeUs  = kRowPeriodUs;
-            rowOffTimeUs = 0;
-            return;
-        }
-
-        rowOnTimeUs = static_cast<uint32_t>((static_cast<uint64_t>(kRowPeriodUs) * brightnessDuty) / brightnessScale);
-        if (rowOnTimeUs >= kRowPeriodUs)
-        {
-            rowOnTimeUs  = kRowPeriodUs;
-            rowOffTimeUs = 0;
+            scanBuffer.build(displayFrame.grayscale);
         }
         else
         {
-            rowOffTimeUs = kRowPeriodUs - rowOnTimeUs;
+            scanBuffer.build(displayFrame.matrix);
         }
+        scanBuffer.setTiming(kRowPeriodUs, displayFrame.brightnessDuty, displayFrame.brightnessScale);
+
+        gScanEngine.queueFrame();
     };
 
-    updateBrightnessTiming();
+    gDisplayTaskHandle = xTaskGetCurrentTaskHandle();
+    prepareFrame();
+    startScanTimer();
 
     for (;;)
     {
-        // sync latest frame data with web task thread
-        if (row == 0)
-        {
-            vTaskDelay(pdMS_TO_TICKS(1));
-
-            portENTER_CRITICAL(&frameDataLock);
-            displayFrame = frameData;
-            portEXIT_CRITICAL(&frameDataLock);
-
-            brightnessScale = displayFrame.brightnessScale;
-            brightnessDuty  = displayFrame.brightnessDuty;
-
-            updateBrightnessTiming();
-        }
-
-        // render current row with per-row PWM timing
-        const uint32_t rowWord = displayFrame.matrix.composeRowWord(row);
-
-        uint32_t offDelayUs = rowOffTimeUs;
-        if (rowOnTimeUs == 0)
-        {
-            offDelayUs = kRowPeriodUs;
-        }
-        else
-        {
-            shiftChain.writeWord(rowWord);
-            waitWithHardwareTimer(rowOnTimeUs);
-        }
+        // woken by the scan ISR once per frame boundary
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
-        shiftChain.writeWord(~0u);
-        if (offDelayUs > 0)
+        if (!gScanEngine.hasPendingFrame())
         {
-            waitWithHardwareTimer(offDelayUs);
+            prepareFrame();
         }
-
-        row = (row + 1) % LED_MATRIX_ROWS;
     }
 }
 
+// earliest upcoming frame change of the active animators; false when nothing is animating
+static bool nextFrameDeadline(uint32_t nowMs, uint32_t& deadlineMs)
+{
+    if (webInterface.getDisplayMode() == DisplayMode::Image)
+        return animatedImage.nextChangeTimestamp(nowMs, deadlineMs);
+    if (webInterface.getDisplayMode() == DisplayMode::Live)
+        return liveFrames.nextChangeTimestamp(nowMs, deadlineMs);
+    if (webInterface.getDisplayMode() == DisplayMode::Grayscale)
+        return false;
+
+    uint32_t topMs    = 0;
+    uint32_t bottomMs = 0;
+    const bool top    = animatedTextTop.nextChangeTimestamp(nowMs, topMs);
+    const bool bottom = animatedTextBottom.nextChangeTimestamp(nowMs, bottomMs);
+
+    if (top && bottom)
+        deadlineMs = (static_cast<int32_t>(topMs - bottomMs) <= 0) ? topMs : bottomMs;
+    else if (top)
+        deadlineMs = topMs;
+    else if (bottom)
+        deadlineMs = bottomMs;
+
+    return top || bottom;
+}
+
 void webTask(void* param)
 {
     (void)param;
+
+    // render only when a command changed the state or an animator is due,
+    // and sleep until the next deadline in between
+    uint32_t renderedRevision = webInterface.getRevision() - 1;
+    uint32_t deadlineMs       = 0;
+    bool     deadlinePending  = false;
+
     for (;;)
     {
         webInterface.handle();
 
-        const uint32_t now = millis();
-        const DisplayMode mode = webInterface.getDisplayMode();
+        uint32_t now = millis();
+        const DisplayMode mode         = webInterface.getDisplayMode();
+        const bool        stateChanged = (webInterface.getRevision() != renderedRevision);
 
-        Matrix16x16 frameMatrix;
-        if (mode == DisplayMode::Text)
+        // live frames arrive without a state change, so look for the first
+        // one of a burst here
+        if (mode == DisplayMode::Live && !deadlinePending)
         {
-            frameMatrix = composeTextFrame(now);
+            deadlinePending = nextFrameDeadline(now, deadlineMs);
         }
-        else
+        const bool deadlineDue  = deadlinePending && (static_cast<int32_t>(deadlineMs - now) <= 0);
+        const bool datagramDue  = (mode == DisplayMode::Live) && udpFrames.hasFrame();
+
+        if (stateChanged || deadlineDue || datagramDue)
         {
-            frameMatrix = animatedImage.update(now);
+            renderedRevision = webInterface.getRevision();
+
+            // compose straight into the exchange buffer; a due deadline that
+            // produced the same pixels publishes nothing. API calls always
+            // publish since brightness or scan settings may have changed.
+            FrameData& frame   = frameExchange.writeBuffer();
+            bool       changed = false;
+            switch (mode)
+            {
+                case DisplayMode::Image:     changed = composeImageFrame(frame.matrix, now, stateChanged); break;
+                case DisplayMode::Grayscale: changed = composeGrayscaleFrame(frame.grayscale, stateChanged); break;
+                case DisplayMode::Live:      changed = composeLiveFrame(frame.matrix, now, stateChanged); break;
+                case DisplayMode::Text:
+                default:                     changed = composeTextFrame(frame.matrix, now, stateChanged); break;
+            }
+            if (changed)
+            {
+                publishFrameData(mode == DisplayMode::Grayscale);
+            }
+            deadlinePending = nextFrameDeadline(now, deadlineMs);
         }
 
-        uint16_t latestBrightnessDuty  = webInterface.getBrightnessDuty();
-        uint16_t latestBrightnessScale = webInterface.getBrightnessScale();
+        // the synchronous web server has no wake-up event, so keep polling it;
+        // faster while live frames may be waiting in the socket
+        now = millis();
+        uint32_t sleepMs = (mode == DisplayMode::Live) ? LIVE_POLL_INTERVAL_MS : WEB_POLL_INTERVAL_MS;
+        if (deadlinePending)
+        {
+            const int32_t untilDeadline = static_cast<int32_t>(deadlineMs - now);
+            if (untilDeadline < static_cast<int32_t>(sleepMs))
+                sleepMs = (untilDeadline > 1) ? static_cast<uint32_t>(untilDeadline) : 1;
+        }
 
-        portENTER_CRITICAL(&frameDataLock);
-        frameData.matrix          = frameMatrix;
-        frameData.brightnessDuty  = latestBrightnessDuty;
-        frameData.brightnessScale = latestBrightnessScale;
-        portEXIT_CRITICAL(&frameDataLock);
-        
-        vTaskDelay(pdMS_TO_TICKS(1));
+        vTaskDelay(pdMS_TO_TICKS(sleepMs));
     }
 }
 
@@ -304,7 +391,7 @@ void setup()
     animatedTextBottom.setLooping(true);
     animatedTextBottom.setText("...");
 
-    updateFrameData(composeTextFrame(millis()));
+    publishTextFrame(millis());
 
     BaseType_t displayResult = xTaskCreatePinnedToCore(displayTask,
                                                        "displayTask",
@@ -332,7 +419,7 @@ void setup()
         }
 
         WiFi.begin(WIFI_SSID, WIFI_PASSWORD != nullptr ? WIFI_PASSWORD : "");
-        updateFrameData(composeTextFrame(millis()));
+        publishTextFrame(millis());
 
         Serial.print(F("Connecting to WiFi"));
 
@@ -349,12 +436,12 @@ void setup()
                 lastDot = now;
             }
 
-            updateFrameData(composeTextFrame(now));
+            publishTextFrame(now);
             delay(kDisplayUpdateInterval);
         }
 
         Serial.println();
-        updateFrameData(composeTextFrame(millis()));
+        publishTextFrame(millis());
 
         wifiConnected = (WiFi.status() == WL_CONNECTED);
         if (wifiConnected)
@@ -374,7 +461,7 @@ void setup()
 
     webInterface.begin();
 
-    updateFrameData(composeTextFrame(millis()));
+    publishTextFrame(millis());
 
     std::string topLine;
     std::string bottomLine;
@@ -412,7 +499,7 @@ void setup()
     animatedTextBottom.setLooping(true);
     animatedTextBottom.setText(bottomLine);
 
-    updateFrameData(composeTextFrame(millis()));
+    publishTextFrame(millis());
 
 
     BaseType_t webResult = xTaskCreatePinnedToCore(webTask,
@@ -85,7 +85,8 @@ void test_animated_text_loops()
     animator.update(15);
     TEST_ASSERT_EQUAL_CHAR('B', animator.currentChar());
 
-    animator.update(30);
+    // steps stay on the 10ms grid started at 0, so the second one is due at 20
+    animator.update(20);
     TEST_ASSERT_EQUAL_CHAR('A', animator.currentChar());
     TEST_ASSERT_FALSE(animator.isFinished());
 }
@@ -131,6 +132,178 @@ void test_animated_text_scroll_loops()
     TEST_ASSERT_NOT_EQUAL('\0', animator.currentChar());
 }
 
+void test_animated_text_ticker_enters_from_right()
+{
+    AnimatedText animator;
+    animator.setVerticalAlignment(AnimatedText::VerticalAlignment::UpperHalf);
+    animator.setAnimationMode(AnimatedText::AnimationMode::Ticker);
+    animator.setFrameDuration(1);
+    animator.setText("H");
+
+    // first frame: the glyph still sits right of the panel
+    Matrix16x16 matrix = animator.update(0);
+    TEST_ASSERT_EQUAL(0, countPixels(matrix));
+
+    // 'H' has its leftmost column lit, so it shows up in the last column after one step
+    matrix = animator.update(1);
+    TEST_ASSERT_TRUE(matrix.getPixel(LED_MATRIX_COLS - 1, 0));
+    TEST_ASSERT_EQUAL(1, static_cast<int>(animator.getTickerPending()));
+}
+
+void test_animated_text_ticker_append_keeps_scrolling()
+{
+    AnimatedText reference;
+    AnimatedText appended;
+    for (AnimatedText* animator : {&reference, &appended})
+    {
+        animator->setVerticalAlignment(AnimatedText::VerticalAlignment::UpperHalf);
+        animator->setAnimationMode(AnimatedText::AnimationMode::Ticker);
+        animator->setFrameDuration(1);
+        animator->setText("ABCD");
+    }
+
+    uint32_t now = 0;
+    for (; now < 12; ++now)
+    {
+        reference.update(now);
+        appended.update(now);
+    }
+
+    TEST_ASSERT_EQUAL(3, static_cast<int>(appended.appendText("XYZ")));
+
+    // the visible window continues exactly where it was
+    for (; now < 20; ++now)
+    {
+        const Matrix16x16 expected = reference.update(now);
+        const Matrix16x16 actual   = appended.update(now);
+        for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+        {
+            TEST_ASSERT_EQUAL_HEX16(expected.getRowBits(y), actual.getRowBits(y));
+        }
+    }
+    TEST_ASSERT_EQUAL(static_cast<int>(reference.getTickerPending()) + 3, static_cast<int>(appended.getTickerPending()));
+}
+
+void test_animated_text_ticker_releases_characters()
+{
+    AnimatedText animator;
+    animator.setVerticalAlignment(AnimatedText::VerticalAlignment::UpperHalf);
+    animator.setAnimationMode(AnimatedText::AnimationMode::Ticker);
+    animator.setFrameDuration(1);
+    animator.setText("AB");
+
+    // 16 steps to reach the left edge, 8 more per glyph to leave it
+    uint32_t now = 0;
+    animator.update(now);
+    while (now < LED_MATRIX_COLS + 8)
+    {
+        animator.update(++now);
+    }
+    TEST_ASSERT_EQUAL(1, static_cast<int>(animator.getTickerPending()));
+    TEST_ASSERT_EQUAL_CHAR('B', animator.currentChar());
+
+    while (now < LED_MATRIX_COLS + 16)
+    {
+        animator.update(++now);
+    }
+    TEST_ASSERT_EQUAL(0, static_cast<int>(animator.getTickerPending()));
+    TEST_ASSERT_EQUAL(0, countPixels(animator.update(++now)));
+    TEST_ASSERT_FALSE(animator.isFinished());
+
+    // the ring is bounded
+    const std::string flood(TEXT_TICKER_CAPACITY + 10, '*');
+    TEST_ASSERT_EQUAL(static_cast<int>(TEXT_TICKER_CAPACITY), static_cast<int>(animator.appendText(flood)));
+    TEST_ASSERT_EQUAL(0, static_cast<int>(animator.appendText("more")));
+}
+
+void test_animated_text_next_change_timestamp()
+{
+    AnimatedText animator;
+    animator.setAnimationMode(AnimatedText::AnimationMode::Hold);
+    animator.setFrameDuration(10);
+    animator.setLooping(false);
+    animator.setText("AB");
+
+    // nothing drawn yet: due immediately
+    uint32_t deadline = 0;
+    TEST_ASSERT_TRUE(animator.nextChangeTimestamp(3, deadline));
+    TEST_ASSERT_EQUAL_UINT32(3, deadline);
+
+    animator.update(3);
+    TEST_ASSERT_TRUE(animator.nextChangeTimestamp(5, deadline));
+    TEST_ASSERT_EQUAL_UINT32(13, deadline);
+
+    // a finished one-shot animation never changes again
+    animator.update(13);
+    animator.update(23);
+    TEST_ASSERT_TRUE(animator.isFinished());
+    TEST_ASSERT_FALSE(animator.nextChangeTimestamp(30, deadline));
+
+    // neither does a single held glyph
+    animator.setLooping(true);
+    animator.setText("A");
+    animator.update(40);
+    TEST_ASSERT_FALSE(animator.nextChangeTimestamp(41, deadline));
+}
+
+void test_animated_text_next_change_timestamp_scroll_and_ticker()
+{
+    AnimatedText animator;
+    animator.setAnimationMode(AnimatedText::AnimationMode::Scroll);
+    animator.setFrameDuration(50);
+    animator.setLooping(true);
+    animator.setText("AB");
+    animator.update(100);
+
+    uint32_t deadline = 0;
+    TEST_ASSERT_TRUE(animator.nextChangeTimestamp(120, deadline));
+    TEST_ASSERT_EQUAL_UINT32(150, deadline);
+
+    // an empty ticker idles until text is appended
+    animator.setText("");
+    animator.setAnimationMode(AnimatedText::AnimationMode::Ticker);
+    animator.update(200);
+    TEST_ASSERT_FALSE(animator.nextChangeTimestamp(210, deadline));
+
+    // appended text restarts the idle ticker instead of catching up on the idle time
+    animator.appendText("C");
+    TEST_ASSERT_TRUE(animator.nextChangeTimestamp(220, deadline));
+    TEST_ASSERT_EQUAL_UINT32(220, deadline);
+
+    animator.update(220);
+    TEST_ASSERT_TRUE(animator.nextChangeTimestamp(230, deadline));
+    TEST_ASSERT_EQUAL_UINT32(270, deadline);
+}
+
+void test_animated_text_render_reports_changes()
+{
+    AnimatedText animator;
+    animator.setAnimationMode(AnimatedText::AnimationMode::Hold);
+    animator.setFrameDuration(10);
+    animator.setLooping(true);
+    animator.setText("AB");
+
+    Matrix16x16 target;
+    TEST_ASSERT_TRUE(animator.render(target, 0));
+    TEST_ASSERT_EQUAL_INT(countPixels(animator.update(0)), countPixels(target));
+
+    // nothing due: the target is left alone
+    target.setPixel(0, 0, true);
+    target.setPixel(15, 15, true);
+    TEST_ASSERT_FALSE(animator.render(target, 5));
+    TEST_ASSERT_TRUE(target.getPixel(15, 15));
+
+    TEST_ASSERT_TRUE(animator.render(target, 10));
+    TEST_ASSERT_EQUAL_CHAR('B', animator.currentChar());
+    TEST_ASSERT_FALSE(animator.render(target, 12));
+
+    // clearing the text is a change as well
+    animator.setText("");
+    TEST_ASSERT_TRUE(animator.render(target, 13));
+    TEST_ASSERT_EQUAL_INT(0, countPixels(target));
+    TEST_ASSERT_FALSE(animator.render(target, 30));
+}
+
 int main(int, char**)
 {
     UNITY_BEGIN();
@@ -139,5 +312,11 @@ int main(int, char**)
     RUN_TEST(test_animated_text_loops);
     RUN_TEST(test_animated_text_scroll_finishes);
     RUN_TEST(test_animated_text_scroll_loops);
+    RUN_TEST(test_animated_text_ticker_enters_from_right);
+    RUN_TEST(test_animated_text_ticker_append_keeps_scrolling);
+    RUN_TEST(test_animated_text_ticker_releases_characters);
+    RUN_TEST(test_animated_text_next_change_timestamp);
+    RUN_TEST(test_animated_text_next_change_timestamp_scroll_and_ticker);
+    RUN_TEST(test_animated_text_render_reports_changes);
     return UNITY_END();
 }
@@ -0,0 +1,211 @@
+#include <unity.h>
+#include <config.h>
+
+#include <cstdint>
+
+#include "AnimatedImage.h"
+#include "AnimatedText.h"
+#include "AnimationTimeline.h"
+#include "Image.h"
+#include "Matrix16x16.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+namespace
+{
+bool sameFrame(const Matrix16x16& a, const Matrix16x16& b)
+{
+    for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+    {
+        if (a.getRowBits(y) != b.getRowBits(y))
+            return false;
+    }
+    return true;
+}
+
+AnimatedText makeScroller(uint32_t frameDurationMs)
+{
+    AnimatedText text;
+    text.setVerticalAlignment(AnimatedText::VerticalAlignment::UpperHalf);
+    text.setAnimationMode(AnimatedText::AnimationMode::Scroll);
+    text.setFrameDuration(frameDurationMs);
+    text.setLooping(true);
+    text.setText("Drift");
+    return text;
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+}
+
+void tearDown(void)
+{
+}
+
+void test_timeline_counts_whole_steps()
+{
+    AnimationTimeline timeline(10);
+    TEST_ASSERT_EQUAL_UINT32(0, timeline.advance(100)); // not started
+
+    timeline.start(100);
+    TEST_ASSERT_EQUAL_UINT32(0, timeline.advance(109));
+    TEST_ASSERT_EQUAL_UINT32(1, timeline.advance(113));
+    TEST_ASSERT_EQUAL_UINT32(120, timeline.nextStepTimestamp());
+
+    // a late call does not shift the grid: the remainder carries over
+    TEST_ASSERT_EQUAL_UINT32(1, timeline.advance(127));
+    TEST_ASSERT_EQUAL_UINT32(1, timeline.advance(130));
+
+    // a stall reports every missed step at once
+    TEST_ASSERT_EQUAL_UINT32(7, timeline.advance(205));
+    TEST_ASSERT_EQUAL_UINT32(210, timeline.nextStepTimestamp());
+}
+
+void test_timeline_ignores_earlier_timestamps_and_wraps()
+{
+    AnimationTimeline timeline(10);
+    timeline.start(0xFFFFFFF0u);
+
+    // out-of-order timestamps count as "nothing due"
+    TEST_ASSERT_EQUAL_UINT32(0, timeline.advance(0xFFFFFF00u));
+
+    // millis() rollover keeps the cadence
+    TEST_ASSERT_EQUAL_UINT32(2, timeline.advance(0x00000005u));
+    TEST_ASSERT_EQUAL_UINT32(0x0000000Eu, timeline.nextStepTimestamp());
+}
+
+void test_timeline_zero_duration_steps_every_call()
+{
+    AnimationTimeline timeline;
+    timeline.start(0);
+    TEST_ASSERT_EQUAL_UINT32(1, timeline.advance(0));
+    TEST_ASSERT_EQUAL_UINT32(1, timeline.advance(0));
+}
+
+void test_scroll_position_independent_of_call_pattern()
+{
+    AnimatedText steady    = makeScroller(20);
+    AnimatedText irregular = makeScroller(20);
+
+    steady.update(0);
+    irregular.update(0);
+
+    // irregular caller: jittered calls and a long stall
+    const uint32_t jittered[] = {3, 19, 41, 44, 95, 96, 130, 700, 701, 755, 1013};
+    uint32_t       nowMs      = 0;
+    for (uint32_t t : jittered)
+    {
+        irregular.update(t);
+        nowMs = t;
+    }
+
+    // the steady caller sees every 1ms tick; both end up on the same pixel
+    for (uint32_t t = 1; t <= nowMs; ++t)
+    {
+        steady.update(t);
+    }
+
+    TEST_ASSERT_TRUE(sameFrame(steady.update(nowMs), irregular.update(nowMs)));
+}
+
+void test_scroll_catches_up_after_stall()
+{
+    AnimatedText stalled = makeScroller(10);
+    stalled.update(0);
+
+    // 37 steps late: the text jumps 37 pixels instead of moving one
+    const Matrix16x16 afterStall = stalled.update(375);
+
+    AnimatedText reference = makeScroller(1);
+    reference.update(0);
+    Matrix16x16 expected;
+    for (uint32_t t = 1; t <= 37; ++t)
+    {
+        expected = reference.update(t);
+    }
+
+    TEST_ASSERT_TRUE(sameFrame(expected, afterStall));
+
+    uint32_t deadline = 0;
+    TEST_ASSERT_TRUE(stalled.nextChangeTimestamp(375, deadline));
+    TEST_ASSERT_EQUAL_UINT32(380, deadline);
+}
+
+void test_one_shot_scroll_finishes_after_long_stall()
+{
+    AnimatedText text = makeScroller(10);
+    text.setLooping(false);
+    text.update(0);
+
+    text.update(100000);
+    TEST_ASSERT_TRUE(text.isFinished());
+}
+
+void test_dual_lines_stay_aligned()
+{
+    AnimatedText top    = makeScroller(30);
+    AnimatedText bottom = makeScroller(30);
+    bottom.setVerticalAlignment(AnimatedText::VerticalAlignment::LowerHalf);
+
+    top.update(0);
+    bottom.update(0);
+
+    // the top line is polled far more often than the bottom one
+    for (uint32_t t = 1; t <= 2000; ++t)
+    {
+        top.update(t);
+        if (t % 97 == 0)
+            bottom.update(t);
+    }
+    bottom.update(2000);
+
+    TEST_ASSERT_EQUAL_CHAR(top.currentChar(), bottom.currentChar());
+
+    uint32_t topDeadline    = 0;
+    uint32_t bottomDeadline = 0;
+    TEST_ASSERT_TRUE(top.nextChangeTimestamp(2000, topDeadline));
+    TEST_ASSERT_TRUE(bottom.nextChangeTimestamp(2000, bottomDeadline));
+    TEST_ASSERT_EQUAL_UINT32(topDeadline, bottomDeadline);
+}
+
+void test_image_sequence_skips_missed_frames()
+{
+    Image frames[3];
+    frames[0].setPixel(0, 0, true);
+    frames[1].setPixel(1, 0, true);
+    frames[2].setPixel(2, 0, true);
+
+    AnimatedImage anim;
+    anim.setFrameDuration(100);
+    anim.setLooping(true);
+    anim.setFrames({frames[0], frames[1], frames[2]});
+
+    anim.update(0);
+    Matrix16x16 matrix = anim.update(450); // 4 frames later
+    TEST_ASSERT_TRUE(matrix.getPixel(1, 0));
+
+    matrix = anim.update(520); // grid stays at 500
+    TEST_ASSERT_TRUE(matrix.getPixel(2, 0));
+
+    anim.setLooping(false);
+    matrix = anim.update(5000);
+    TEST_ASSERT_TRUE(matrix.getPixel(2, 0));
+    TEST_ASSERT_TRUE(anim.isFinished());
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_timeline_counts_whole_steps);
+    RUN_TEST(test_timeline_ignores_earlier_timestamps_and_wraps);
+    RUN_TEST(test_timeline_zero_duration_steps_every_call);
+    RUN_TEST(test_scroll_position_independent_of_call_pattern);
+    RUN_TEST(test_scroll_catches_up_after_stall);
+    RUN_TEST(test_one_shot_scroll_finishes_after_long_stall);
+    RUN_TEST(test_dual_lines_stay_aligned);
+    RUN_TEST(test_image_sequence_skips_missed_frames);
+    return UNITY_END();
+}
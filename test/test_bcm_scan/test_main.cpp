@@ -0,0 +1,313 @@
+#include <unity.h>
+#include <config.h>
+
+#include <array>
+#include <cstdint>
+
+#include "GrayscaleMatrix.h"
+#include "ScanBuffer.h"
+#include "ScanEngine.h"
+#include "ShiftRegisterChain.h"
+
+MockBackend*       gBackend = nullptr;
+MockBackend        backend;
+ShiftRegisterChain shiftRegister;
+
+namespace
+{
+constexpr uint32_t kRowPeriodUs    = 520;
+constexpr uint32_t kBrightnessScale = 32; // WebInterface::kBrightnessFixedScale
+
+// the shortest phase has to cover the transfer of one word through the chain
+constexpr uint64_t kWordTransferNs = (SR_CHAIN_CHIPS * 8ull * 1000000000ull) / SHIFTREG_SPI_FREQUENCY_HZ;
+static_assert(SCAN_MIN_PHASE_US * 1000ull > kWordTransferNs, "a phase may not end before its word is latched");
+
+// Simulated clock: every wait integrates the on-time of the LEDs that are
+// currently latched into the shift register chain. Latching is free here; the
+// MockBackend clock charges the word transfer and is checked where it matters.
+struct SimulatedClock
+{
+    uint64_t nowUs = 0;
+    std::array<std::array<uint32_t, LED_MATRIX_COLS>, LED_MATRIX_ROWS> litUs{};
+
+    void operator()(uint32_t us)
+    {
+        for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+        {
+            for (int x = 0; x < LED_MATRIX_COLS; ++x)
+            {
+                if (backend.isLedOn(x, y))
+                {
+                    litUs[y][x] += us;
+                }
+            }
+        }
+
+        nowUs += us;
+    }
+};
+
+// every lit phase of every row outlasts the word transfer that starts it
+void assertPhasesOutlastLatch(const ScanBuffer& scanBuffer)
+{
+    for (int plane = 0; plane < scanBuffer.getPlaneCount(); ++plane)
+    {
+        for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+        {
+            const uint32_t onTimeUs = scanBuffer.planeOnTimeUs(plane, row);
+            TEST_ASSERT_TRUE(onTimeUs == 0 || onTimeUs >= SCAN_MIN_PHASE_US);
+        }
+    }
+}
+
+// step the ISR state machine through one frame of the queued buffer
+void scanFrame(ScanEngine& engine, SimulatedClock& clock)
+{
+    int framesStarted = 0;
+    for (;;)
+    {
+        ScanEngine::Step step = engine.step();
+        if (step.frameStart && ++framesStarted > 1)
+            break;
+
+        shiftRegister.writeWord(step.word);
+        clock(step.durationUs);
+    }
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+    backend.reset();
+    shiftRegister.begin();
+}
+
+void tearDown(void)
+{
+}
+
+void test_grayscale_pixel_levels()
+{
+    GrayscaleMatrix matrix(5);
+    matrix.clear();
+
+    matrix.setPixel(0, 0, 0);
+    matrix.setPixel(1, 0, 17);
+    matrix.setPixel(15, 15, 31);
+    matrix.setPixel(2, 2, 200); // clamps to the maximum level
+
+    TEST_ASSERT_EQUAL(31, matrix.maxLevel());
+    TEST_ASSERT_EQUAL(0,  matrix.getPixel(0, 0));
+    TEST_ASSERT_EQUAL(17, matrix.getPixel(1, 0));
+    TEST_ASSERT_EQUAL(31, matrix.getPixel(15, 15));
+    TEST_ASSERT_EQUAL(31, matrix.getPixel(2, 2));
+
+    TEST_ASSERT_EQUAL_HEX16(0x4000, matrix.getPlaneRowBits(0, 0));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, matrix.getPlaneRowBits(1, 0));
+    TEST_ASSERT_EQUAL_HEX16(0x4000, matrix.getPlaneRowBits(4, 0));
+}
+
+void test_grayscale_bit_depth_is_clamped()
+{
+    GrayscaleMatrix matrix(2);
+    TEST_ASSERT_EQUAL(GrayscaleMatrix::kMinBitDepth, matrix.getBitDepth());
+
+    matrix.setBitDepth(9);
+    TEST_ASSERT_EQUAL(GrayscaleMatrix::kMaxBitDepth, matrix.getBitDepth());
+}
+
+void test_bcm_row_cost_is_fixed()
+{
+    for (int depth = GrayscaleMatrix::kMinBitDepth; depth <= GrayscaleMatrix::kMaxBitDepth; ++depth)
+    {
+        GrayscaleMatrix matrix(depth);
+        matrix.setPixel(4, 4, static_cast<uint8_t>(matrix.maxLevel() / 3));
+
+        ScanEngine  engine;
+        ScanBuffer& scanBuffer = engine.backBuffer();
+        scanBuffer.build(matrix);
+        scanBuffer.setTiming(kRowPeriodUs, 1, 1);
+        engine.queueFrame();
+
+        SimulatedClock clock;
+        scanFrame(engine, clock);
+
+        TEST_ASSERT_EQUAL(depth, scanBuffer.getPlaneCount());
+        TEST_ASSERT_EQUAL_UINT64(static_cast<uint64_t>(kRowPeriodUs) * LED_MATRIX_ROWS, clock.nowUs);
+    }
+}
+
+void test_bcm_lit_time_per_pixel()
+{
+    GrayscaleMatrix matrix(4);
+    matrix.clear();
+
+    for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+    {
+        for (int x = 0; x < LED_MATRIX_COLS; ++x)
+        {
+            matrix.setPixel(x, y, static_cast<uint8_t>((x + y) % 16));
+        }
+    }
+
+    ScanEngine  engine;
+    ScanBuffer& scanBuffer = engine.backBuffer();
+    scanBuffer.build(matrix);
+    scanBuffer.setTiming(kRowPeriodUs, 1, 1);
+    engine.queueFrame();
+
+    // plane k gets 2^k / 15 of the row period, rounded per plane, so no lit time is lost
+    uint32_t planeUs[4] = {};
+    uint32_t rowUs      = 0;
+    for (int plane = 0; plane < 4; ++plane)
+    {
+        planeUs[plane] = ((kRowPeriodUs << plane) + 7u) / 15u;
+        TEST_ASSERT_EQUAL_UINT32(planeUs[plane], scanBuffer.planeOnTimeUs(plane, 0));
+        rowUs += planeUs[plane];
+    }
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, rowUs);
+
+    SimulatedClock clock;
+    scanFrame(engine, clock);
+
+    for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+    {
+        for (int x = 0; x < LED_MATRIX_COLS; ++x)
+        {
+            uint32_t expectedUs = 0;
+            for (int plane = 0; plane < 4; ++plane)
+            {
+                if (matrix.getPixel(x, y) & (1u << plane))
+                    expectedUs += planeUs[plane];
+            }
+            TEST_ASSERT_EQUAL_UINT32(expectedUs, clock.litUs[y][x]);
+        }
+    }
+}
+
+void test_bcm_scales_with_brightness()
+{
+    GrayscaleMatrix matrix(6);
+    matrix.setPixel(7, 3, 63);
+    matrix.setPixel(8, 3, 1);
+    matrix.setPixel(9, 3, 4);
+
+    ScanEngine  engine;
+    ScanBuffer& scanBuffer = engine.backBuffer();
+    scanBuffer.build(matrix);
+    scanBuffer.setTiming(kRowPeriodUs, 16, 32);
+    engine.queueFrame();
+
+    // half the row split into 63 units would give a 4 us LSB, shorter than the latch:
+    // the two lowest planes are dropped and the rest share the lit time in fifteenths
+    const uint32_t litUs = kRowPeriodUs / 2;
+    TEST_ASSERT_EQUAL(2, scanBuffer.droppedPlaneCount());
+    TEST_ASSERT_EQUAL_UINT32(0, scanBuffer.planeOnTimeUs(0, 3));
+    TEST_ASSERT_EQUAL_UINT32(0, scanBuffer.planeOnTimeUs(1, 3));
+    TEST_ASSERT_EQUAL_UINT32((litUs + 7u) / 15u, scanBuffer.planeOnTimeUs(2, 3));
+    assertPhasesOutlastLatch(scanBuffer);
+
+    SimulatedClock clock;
+    scanFrame(engine, clock);
+
+    TEST_ASSERT_EQUAL_UINT32(litUs,                          clock.litUs[3][7]);
+    TEST_ASSERT_EQUAL_UINT32(0,                              clock.litUs[3][8]); // below the coarsest level left
+    TEST_ASSERT_EQUAL_UINT32(scanBuffer.planeOnTimeUs(2, 3), clock.litUs[3][9]);
+    TEST_ASSERT_EQUAL_UINT32(0,                              clock.litUs[3][10]);
+    TEST_ASSERT_EQUAL_UINT64(static_cast<uint64_t>(kRowPeriodUs) * LED_MATRIX_ROWS, clock.nowUs);
+}
+
+void test_bcm_lowest_duty_keeps_lit_pixels()
+{
+    for (int depth = GrayscaleMatrix::kMinBitDepth; depth <= GrayscaleMatrix::kMaxBitDepth; ++depth)
+    {
+        for (uint32_t duty = 1; duty <= 3; ++duty)
+        {
+            GrayscaleMatrix matrix(depth);
+            matrix.setPixel(5, 2, matrix.maxLevel());
+            matrix.setPixel(6, 2, static_cast<uint8_t>(1u << (depth - 1))); // MSB only
+
+            backend.resetTiming();
+
+            ScanEngine  engine;
+            ScanBuffer& scanBuffer = engine.backBuffer();
+            scanBuffer.build(matrix);
+            scanBuffer.setTiming(kRowPeriodUs, duty, kBrightnessScale);
+            engine.queueFrame();
+
+            assertPhasesOutlastLatch(scanBuffer);
+
+            SimulatedClock clock;
+            scanFrame(engine, clock);
+
+            // the full level keeps the requested lit time up to rounding, the MSB alone stays visible
+            const uint32_t requestedUs = (kRowPeriodUs * duty) / kBrightnessScale;
+            TEST_ASSERT_UINT32_WITHIN(static_cast<uint32_t>(depth), requestedUs, clock.litUs[2][5]);
+            TEST_ASSERT_TRUE(clock.litUs[2][6] >= SCAN_MIN_PHASE_US);
+            TEST_ASSERT_TRUE(backend.ledOnTimeNs(5, 2) > 0);
+            TEST_ASSERT_TRUE(backend.ledOnTimeNs(6, 2) > 0);
+        }
+    }
+}
+
+void test_bcm_phases_outlast_latch_at_every_duty()
+{
+    for (int depth = GrayscaleMatrix::kMinBitDepth; depth <= GrayscaleMatrix::kMaxBitDepth; ++depth)
+    {
+        GrayscaleMatrix matrix(depth);
+        for (int x = 0; x < LED_MATRIX_COLS; ++x)
+        {
+            matrix.setPixel(x, x % LED_MATRIX_ROWS, static_cast<uint8_t>(x % (matrix.maxLevel() + 1)));
+        }
+        matrix.setPixel(0, 1, matrix.maxLevel());
+
+        ScanBuffer scanBuffer;
+        scanBuffer.build(matrix);
+        for (uint32_t duty = 1; duty <= kBrightnessScale; ++duty)
+        {
+            scanBuffer.setTiming(kRowPeriodUs, duty, kBrightnessScale);
+            assertPhasesOutlastLatch(scanBuffer);
+
+            uint32_t fullLevelUs = 0;
+            for (int plane = 0; plane < depth; ++plane)
+            {
+                fullLevelUs += scanBuffer.planeOnTimeUs(plane, 1);
+            }
+            TEST_ASSERT_TRUE(fullLevelUs > 0);
+        }
+    }
+}
+
+void test_monochrome_frame_uses_single_plane()
+{
+    Matrix16x16 matrix;
+    matrix.setPixel(0, 0, true);
+
+    ScanEngine  engine;
+    ScanBuffer& scanBuffer = engine.backBuffer();
+    scanBuffer.build(matrix);
+    scanBuffer.setTiming(kRowPeriodUs, 8, 32);
+    engine.queueFrame();
+
+    SimulatedClock clock;
+    scanFrame(engine, clock);
+
+    TEST_ASSERT_EQUAL(1, scanBuffer.getPlaneCount());
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs / 4, clock.litUs[0][0]);
+    TEST_ASSERT_EQUAL_UINT32(0,                clock.litUs[0][1]);
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_grayscale_pixel_levels);
+    RUN_TEST(test_grayscale_bit_depth_is_clamped);
+    RUN_TEST(test_bcm_row_cost_is_fixed);
+    RUN_TEST(test_bcm_lit_time_per_pixel);
+    RUN_TEST(test_bcm_scales_with_brightness);
+    RUN_TEST(test_bcm_lowest_duty_keeps_lit_pixels);
+    RUN_TEST(test_bcm_phases_outlast_latch_at_every_duty);
+    RUN_TEST(test_monochrome_frame_uses_single_plane);
+    return UNITY_END();
+}
@@ -0,0 +1,148 @@
+#include <unity.h>
+#include <config.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "FrameExchange.h"
+#include "Matrix16x16.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+namespace
+{
+// every field carries the same sequence number, so a torn read shows up as a mismatch
+struct StressFrame
+{
+    uint32_t                 sequence = 0;
+    std::array<uint32_t, 64> payload{};
+    Matrix16x16              matrix;
+};
+
+void fillFrame(StressFrame& frame, uint32_t sequence)
+{
+    frame.sequence = sequence;
+    frame.payload.fill(sequence);
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        frame.matrix.setRowBits(row, static_cast<uint16_t>(sequence + row));
+    }
+}
+
+bool frameIsConsistent(const StressFrame& frame)
+{
+    for (uint32_t value : frame.payload)
+    {
+        if (value != frame.sequence)
+            return false;
+    }
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        if (frame.matrix.getRowBits(row) != static_cast<uint16_t>(frame.sequence + row))
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+}
+
+void tearDown(void)
+{
+}
+
+void test_exchange_nothing_published()
+{
+    FrameExchange<StressFrame> exchange;
+    TEST_ASSERT_FALSE(exchange.acquire());
+    TEST_ASSERT_EQUAL_UINT32(0, exchange.readBuffer().sequence);
+}
+
+void test_exchange_returns_newest_frame()
+{
+    FrameExchange<StressFrame> exchange;
+
+    for (uint32_t sequence = 1; sequence <= 3; ++sequence)
+    {
+        fillFrame(exchange.writeBuffer(), sequence);
+        exchange.publish();
+    }
+
+    TEST_ASSERT_TRUE(exchange.acquire());
+    TEST_ASSERT_EQUAL_UINT32(3, exchange.readBuffer().sequence);
+    TEST_ASSERT_TRUE(frameIsConsistent(exchange.readBuffer()));
+
+    // nothing new: keep showing the last frame
+    TEST_ASSERT_FALSE(exchange.acquire());
+    TEST_ASSERT_EQUAL_UINT32(3, exchange.readBuffer().sequence);
+
+    fillFrame(exchange.writeBuffer(), 4);
+    exchange.publish();
+    TEST_ASSERT_TRUE(exchange.acquire());
+    TEST_ASSERT_EQUAL_UINT32(4, exchange.readBuffer().sequence);
+}
+
+void test_exchange_threaded_stress_no_tearing()
+{
+    constexpr uint32_t kFrames = 200000;
+
+    FrameExchange<StressFrame> exchange;
+    std::atomic<bool>          producerDone{false};
+
+    std::thread producer([&]() {
+        for (uint32_t sequence = 1; sequence <= kFrames; ++sequence)
+        {
+            fillFrame(exchange.writeBuffer(), sequence);
+            exchange.publish();
+        }
+        producerDone.store(true, std::memory_order_release);
+    });
+
+    uint32_t torn         = 0;
+    uint32_t outOfOrder   = 0;
+    uint32_t framesSeen   = 0;
+    uint32_t lastSequence = 0;
+
+    for (;;)
+    {
+        const bool done = producerDone.load(std::memory_order_acquire);
+
+        if (exchange.acquire())
+        {
+            const StressFrame& frame = exchange.readBuffer();
+            if (!frameIsConsistent(frame))
+                ++torn;
+            if (frame.sequence <= lastSequence)
+                ++outOfOrder;
+
+            lastSequence = frame.sequence;
+            ++framesSeen;
+        }
+        else if (done)
+        {
+            break;
+        }
+    }
+
+    producer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, torn);
+    TEST_ASSERT_EQUAL_UINT32(0, outOfOrder);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, framesSeen);
+    TEST_ASSERT_EQUAL_UINT32(kFrames, lastSequence);
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_exchange_nothing_published);
+    RUN_TEST(test_exchange_returns_newest_frame);
+    RUN_TEST(test_exchange_threaded_stress_no_tearing);
+    return UNITY_END();
+}
@@ -0,0 +1,398 @@
+#include <unity.h>
+#include <config.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "AnimatedImage.h"
+#include "FrameStore.h"
+#include "Image.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+namespace
+{
+constexpr int kDecodeIterations = 200;
+
+bool sameImage(const Image& a, const Image& b)
+{
+    for (int y = 0; y < Image::kHeight; ++y)
+    {
+        if (a.getRow(y) != b.getRow(y))
+            return false;
+    }
+    return true;
+}
+
+// deterministic pseudo-random pixels
+Image noiseFrame(uint32_t& state)
+{
+    Image image;
+    for (int y = 0; y < Image::kHeight; ++y)
+    {
+        for (int x = 0; x < Image::kWidth; ++x)
+        {
+            state = state * 1664525u + 1013904223u;
+            image.setPixel(x, y, (state >> 31) != 0);
+        }
+    }
+    return image;
+}
+
+// 4x4 block bouncing around the panel
+std::vector<Image> bouncingSprite(int count)
+{
+    std::vector<Image> frames;
+    int x = 0, y = 3, dx = 1, dy = 1;
+    for (int i = 0; i < count; ++i)
+    {
+        Image image;
+        for (int py = 0; py < 4; ++py)
+            for (int px = 0; px < 4; ++px)
+                image.setPixel(x + px, y + py, true);
+        frames.push_back(image);
+
+        if (x + dx < 0 || x + dx > Image::kWidth - 4)  dx = -dx;
+        if (y + dy < 0 || y + dy > Image::kHeight - 4) dy = -dy;
+        x += dx;
+        y += dy;
+    }
+    return frames;
+}
+
+// outlined frame with a growing bar graph, each state held for several frames
+std::vector<Image> heldBarGraph(int count)
+{
+    std::vector<Image> frames;
+    for (int i = 0; i < count; ++i)
+    {
+        Image image;
+        for (int k = 0; k < Image::kWidth; ++k)
+        {
+            image.setPixel(k, 0, true);
+            image.setPixel(k, Image::kHeight - 1, true);
+            image.setPixel(0, k, true);
+            image.setPixel(Image::kWidth - 1, k, true);
+        }
+        const int level = (i / 8) % (Image::kHeight - 2);
+        for (int row = 0; row < level; ++row)
+            for (int col = 2; col < Image::kWidth - 2; col += 3)
+                image.setPixel(col, Image::kHeight - 2 - row, true);
+        frames.push_back(image);
+    }
+    return frames;
+}
+
+// bouncing sprite played forwards and back again
+std::vector<Image> pingPong(int count)
+{
+    std::vector<Image> frames = bouncingSprite(count);
+    for (int i = count - 2; i > 0; --i)
+        frames.push_back(frames[static_cast<size_t>(i)]);
+    return frames;
+}
+
+std::vector<Image> randomNoise(int count)
+{
+    std::vector<Image> frames;
+    uint32_t state = 12345u;
+    for (int i = 0; i < count; ++i)
+        frames.push_back(noiseFrame(state));
+    return frames;
+}
+
+FrameStore encodeAll(const std::vector<Image>& frames)
+{
+    FrameStore store;
+    for (const Image& frame : frames)
+        store.append(frame);
+    return store;
+}
+
+void benchmark(const char* name, const std::vector<Image>& frames)
+{
+    const FrameStore store = encodeAll(frames);
+
+    const size_t rawBytes = frames.size() * Image::kTotalBytes;
+    const double ratio    = static_cast<double>(rawBytes) / static_cast<double>(store.encodedBytes());
+
+    volatile uint32_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int iteration = 0; iteration < kDecodeIterations; ++iteration)
+    {
+        FrameStore::Cursor cursor;
+        for (size_t i = 0; i < store.size(); ++i)
+        {
+            store.seek(cursor, i);
+            sink = sink + cursor.bytes[i % cursor.bytes.size()];
+        }
+    }
+    const auto   elapsed  = std::chrono::steady_clock::now() - start;
+    const double perFrame = std::chrono::duration<double, std::nano>(elapsed).count() /
+                            (static_cast<double>(kDecodeIterations) * store.size());
+
+    printf("[bench] %-14s %4u frames (%3u unique): %6u -> %5u bytes (%.1fx), sequential decode %.0f ns/frame\n",
+           name, static_cast<unsigned>(frames.size()), static_cast<unsigned>(store.uniqueCount()),
+           static_cast<unsigned>(rawBytes), static_cast<unsigned>(store.encodedBytes()), ratio, perFrame);
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+}
+
+void tearDown(void)
+{
+}
+
+void test_round_trip_sequences()
+{
+    const std::vector<Image> sequences[] = {bouncingSprite(70), heldBarGraph(70), randomNoise(40)};
+
+    for (const std::vector<Image>& frames : sequences)
+    {
+        const FrameStore store = encodeAll(frames);
+        TEST_ASSERT_EQUAL(frames.size(), store.size());
+
+        FrameStore::Cursor cursor;
+        for (size_t i = 0; i < frames.size(); ++i)
+        {
+            store.seek(cursor, i);
+            TEST_ASSERT_TRUE(sameImage(frames[i], cursor.toImage()));
+        }
+    }
+}
+
+void test_append_packed_bytes()
+{
+    // the layout a binary upload delivers
+    const std::vector<Image> frames = heldBarGraph(20);
+
+    FrameStore fromImages = encodeAll(frames);
+    FrameStore fromBytes;
+    for (const Image& frame : frames)
+    {
+        FrameStore::Bytes bytes;
+        FrameStore::toBytes(frame, bytes);
+        fromBytes.append(bytes);
+    }
+
+    TEST_ASSERT_EQUAL(fromImages.size(), fromBytes.size());
+    TEST_ASSERT_EQUAL(fromImages.encodedBytes(), fromBytes.encodedBytes());
+    for (size_t i = 0; i < frames.size(); ++i)
+        TEST_ASSERT_TRUE(sameImage(frames[i], fromBytes.frame(i)));
+}
+
+void test_random_access_and_backwards_seek()
+{
+    const std::vector<Image> frames = bouncingSprite(50);
+    const FrameStore         store  = encodeAll(frames);
+
+    const size_t order[] = {49, 3, 17, 16, 15, 0, 33, 34, 48, 2};
+    FrameStore::Cursor cursor;
+    for (size_t index : order)
+    {
+        store.seek(cursor, index);
+        TEST_ASSERT_EQUAL(index, cursor.index);
+        TEST_ASSERT_TRUE(sameImage(frames[index], cursor.toImage()));
+        TEST_ASSERT_TRUE(sameImage(frames[index], store.frame(index)));
+    }
+}
+
+void test_unchanged_frames_cost_one_byte()
+{
+    Image image;
+    image.setPixel(5, 5, true);
+
+    FrameStore store(100);
+    store.append(image);
+    const size_t afterKeyframe = store.encodedBytes();
+
+    for (int i = 0; i < 10; ++i)
+        store.append(image);
+
+    TEST_ASSERT_EQUAL(afterKeyframe + 10, store.encodedBytes());
+}
+
+void test_duplicate_frames_are_interned()
+{
+    const std::vector<Image> forward = bouncingSprite(30);
+    const std::vector<Image> frames  = pingPong(30);
+
+    const FrameStore once = encodeAll(forward);
+    const FrameStore both = encodeAll(frames);
+    TEST_ASSERT_EQUAL(frames.size(), both.size());
+    TEST_ASSERT_EQUAL(once.uniqueCount(), both.uniqueCount());
+
+    // the way back is only one index byte per frame
+    TEST_ASSERT_EQUAL(once.encodedBytes() + (frames.size() - forward.size()), both.encodedBytes());
+
+    FrameStore::Cursor cursor;
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        both.seek(cursor, i);
+        TEST_ASSERT_EQUAL(i, cursor.index);
+        TEST_ASSERT_TRUE(sameImage(frames[i], cursor.toImage()));
+    }
+}
+
+void test_blink_stores_two_frames()
+{
+    Image on;
+    on.setPixel(7, 7, true);
+    const Image off;
+
+    FrameStore store;
+    for (int i = 0; i < 100; ++i)
+        store.append(i % 2 ? off : on);
+
+    TEST_ASSERT_EQUAL(100, store.size());
+    TEST_ASSERT_EQUAL(2, store.uniqueCount());
+    TEST_ASSERT_TRUE(sameImage(on, store.frame(98)));
+    TEST_ASSERT_TRUE(sameImage(off, store.frame(99)));
+}
+
+void test_wide_indices_beyond_256_unique_frames()
+{
+    // 300 distinct frames, then the first ones again
+    std::vector<Image> frames = randomNoise(300);
+    frames.push_back(frames[0]);
+    frames.push_back(frames[255]);
+    frames.push_back(frames[299]);
+
+    FrameStore store;
+    for (const Image& frame : frames)
+        store.append(frame);
+    store.shrinkToFit();
+
+    TEST_ASSERT_EQUAL(303, store.size());
+    TEST_ASSERT_EQUAL(300, store.uniqueCount());
+
+    const size_t order[] = {0, 255, 256, 299, 300, 301, 302, 17};
+    FrameStore::Cursor cursor;
+    for (size_t index : order)
+    {
+        store.seek(cursor, index);
+        TEST_ASSERT_TRUE(sameImage(frames[index], cursor.toImage()));
+    }
+}
+
+void test_runs_and_literals_at_token_limits()
+{
+    // long runs of a repeated byte, literals next to zeros, and a full panel
+    Image full;
+    for (int y = 0; y < Image::kHeight; ++y)
+        full.setRow(y, static_cast<Image::Row>(~Image::Row{}));
+
+    Image stripes;
+    for (int y = 0; y < Image::kHeight; y += 2)
+        stripes.setRow(y, static_cast<Image::Row>(0xA5C3u));
+
+    const std::vector<Image> frames = {full, Image(), stripes, full, stripes};
+    FrameStore store(2);
+    for (const Image& frame : frames)
+        store.append(frame);
+
+    for (size_t i = 0; i < frames.size(); ++i)
+        TEST_ASSERT_TRUE(sameImage(frames[i], store.frame(i)));
+}
+
+void test_durations_prefix_sums()
+{
+    const std::vector<Image> frames = bouncingSprite(4);
+    const uint32_t durations[]      = {100, 20, 0, 300}; // 0 is stored as 1 ms
+
+    FrameStore store;
+    for (size_t i = 0; i < frames.size(); ++i)
+        store.append(frames[i], durations[i]);
+
+    TEST_ASSERT_TRUE(store.hasDurations());
+    TEST_ASSERT_EQUAL_UINT32(421, store.totalDurationMs());
+    TEST_ASSERT_EQUAL_UINT32(120, store.frameStartMs(2));
+    TEST_ASSERT_EQUAL_UINT32(1, store.durationMs(2));
+
+    TEST_ASSERT_EQUAL(0, store.frameAt(0));
+    TEST_ASSERT_EQUAL(0, store.frameAt(99));
+    TEST_ASSERT_EQUAL(1, store.frameAt(100));
+    TEST_ASSERT_EQUAL(2, store.frameAt(120));
+    TEST_ASSERT_EQUAL(3, store.frameAt(121));
+    TEST_ASSERT_EQUAL(3, store.frameAt(5000));
+
+    FrameStore uniform = encodeAll(frames);
+    TEST_ASSERT_FALSE(uniform.hasDurations());
+    TEST_ASSERT_EQUAL_UINT32(0, uniform.totalDurationMs());
+}
+
+void test_animated_image_plays_compressed_frames()
+{
+    const std::vector<Image> frames = bouncingSprite(40);
+
+    AnimatedImage anim;
+    anim.setFrameDuration(10);
+    anim.setLooping(true);
+    anim.setFrames(frames);
+    TEST_ASSERT_EQUAL(frames.size(), anim.frameCount());
+    TEST_ASSERT_TRUE(anim.encodedBytes() < frames.size() * Image::kTotalBytes);
+
+    Matrix16x16 expected;
+    for (uint32_t t = 0; t < 500; t += 10)
+    {
+        const Matrix16x16 actual = anim.update(t);
+        frames[(t / 10) % frames.size()].draw(expected);
+        for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+            TEST_ASSERT_EQUAL_HEX16(expected.getRowBits(y), actual.getRowBits(y));
+    }
+}
+
+void test_animated_image_shares_sequence()
+{
+    std::shared_ptr<FrameStore> store = std::make_shared<FrameStore>();
+    for (const Image& frame : bouncingSprite(20))
+        store->append(frame);
+
+    const FrameSequence sequence = std::move(store);
+
+    AnimatedImage anim;
+    anim.setFrames(sequence);
+
+    // adopted by reference, not copied
+    TEST_ASSERT_TRUE(anim.getFrames().get() == sequence.get());
+    TEST_ASSERT_EQUAL(2, sequence.use_count());
+    TEST_ASSERT_EQUAL(20, anim.frameCount());
+
+    // clearing the player only drops its own reference
+    FrameSequence other = sequence;
+    anim.clearFrames();
+    TEST_ASSERT_EQUAL(0, anim.frameCount());
+    TEST_ASSERT_EQUAL(2, other.use_count());
+}
+
+void test_benchmark_compression()
+{
+    benchmark("bouncing", bouncingSprite(256));
+    benchmark("held bar graph", heldBarGraph(256));
+    benchmark("random noise", randomNoise(256));
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip_sequences);
+    RUN_TEST(test_append_packed_bytes);
+    RUN_TEST(test_random_access_and_backwards_seek);
+    RUN_TEST(test_unchanged_frames_cost_one_byte);
+    RUN_TEST(test_duplicate_frames_are_interned);
+    RUN_TEST(test_blink_stores_two_frames);
+    RUN_TEST(test_wide_indices_beyond_256_unique_frames);
+    RUN_TEST(test_runs_and_literals_at_token_limits);
+    RUN_TEST(test_durations_prefix_sums);
+    RUN_TEST(test_animated_image_plays_compressed_frames);
+    RUN_TEST(test_animated_image_shares_sequence);
+    RUN_TEST(test_benchmark_compression);
+    return UNITY_END();
+}
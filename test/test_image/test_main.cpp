@@ -3,6 +3,7 @@
 
 #include "Image.h"
 #include "AnimatedImage.h"
+#include "FrameStore.h"
 #include "Matrix16x16.h"
 
 MockBackend* gBackend = nullptr;
@@ -68,12 +69,234 @@ void test_animated_image_sequence()
     TEST_ASSERT_TRUE(matrix.getPixel(15, 15));
 }
 
+void test_animated_image_next_change_timestamp()
+{
+    Image frameA;
+    frameA.setPixel(0, 0, true);
+    Image frameB;
+    frameB.setPixel(15, 15, true);
+
+    AnimatedImage anim;
+    uint32_t deadline = 0;
+    TEST_ASSERT_FALSE(anim.nextChangeTimestamp(0, deadline));
+
+    anim.setLooping(false);
+    anim.setFrameDuration(10);
+    anim.setFrames({frameA, frameB});
+
+    TEST_ASSERT_TRUE(anim.nextChangeTimestamp(2, deadline));
+    TEST_ASSERT_EQUAL_UINT32(2, deadline);
+
+    anim.update(2);
+    TEST_ASSERT_TRUE(anim.nextChangeTimestamp(4, deadline));
+    TEST_ASSERT_EQUAL_UINT32(12, deadline);
+
+    // the last frame of a one-shot sequence stays on screen
+    anim.update(12);
+    TEST_ASSERT_FALSE(anim.nextChangeTimestamp(20, deadline));
+
+    // a single frame never changes, looping or not
+    anim.setLooping(true);
+    anim.setFrames({frameA});
+    anim.update(30);
+    TEST_ASSERT_FALSE(anim.nextChangeTimestamp(31, deadline));
+}
+
+void test_animated_image_render_reports_changes()
+{
+    Image frameA;
+    frameA.setPixel(0, 0, true);
+    Image frameB;
+    frameB.setPixel(15, 15, true);
+
+    AnimatedImage anim;
+    anim.setLooping(false);
+    anim.setFrameDuration(10);
+    anim.setFrames({frameA, frameB});
+
+    Matrix16x16 target;
+    TEST_ASSERT_TRUE(anim.render(target, 0));
+    TEST_ASSERT_TRUE(target.getPixel(0, 0));
+    TEST_ASSERT_FALSE(anim.render(target, 5));
+
+    TEST_ASSERT_TRUE(anim.render(target, 10));
+    TEST_ASSERT_FALSE(target.getPixel(0, 0));
+    TEST_ASSERT_TRUE(target.getPixel(15, 15));
+
+    // the finished sequence holds its last frame without reporting changes
+    TEST_ASSERT_FALSE(anim.render(target, 100));
+}
+
+namespace
+{
+// frame i lights pixel (i, 0)
+FrameSequence markerSequence(const std::vector<uint32_t>& durations)
+{
+    std::shared_ptr<FrameStore> store = std::make_shared<FrameStore>();
+    for (size_t i = 0; i < durations.size(); ++i)
+    {
+        Image image;
+        image.setPixel(static_cast<int>(i), 0, true);
+        store->append(image, durations[i]);
+    }
+    return store;
+}
+
+// same markers without per-frame durations
+FrameSequence uniformMarkers(size_t count)
+{
+    std::shared_ptr<FrameStore> store = std::make_shared<FrameStore>();
+    for (size_t i = 0; i < count; ++i)
+    {
+        Image image;
+        image.setPixel(static_cast<int>(i), 0, true);
+        store->append(image);
+    }
+    return store;
+}
+
+int shownFrame(const Matrix16x16& matrix)
+{
+    for (int x = 0; x < LED_MATRIX_COLS; ++x)
+    {
+        if (matrix.getPixel(x, 0))
+            return x;
+    }
+    return -1;
+}
+} // namespace
+
+void test_animated_image_per_frame_durations()
+{
+    AnimatedImage anim;
+    anim.setLooping(true);
+    anim.setFrames(markerSequence({100, 20, 20, 300})); // 440 ms per cycle
+
+    TEST_ASSERT_EQUAL(0, shownFrame(anim.update(1000)));
+    TEST_ASSERT_EQUAL(0, shownFrame(anim.update(1099)));
+    TEST_ASSERT_EQUAL(1, shownFrame(anim.update(1100)));
+
+    uint32_t deadline = 0;
+    TEST_ASSERT_TRUE(anim.nextChangeTimestamp(1105, deadline));
+    TEST_ASSERT_EQUAL_UINT32(1120, deadline);
+
+    // a late update lands on the right frame directly, also in a later cycle
+    TEST_ASSERT_EQUAL(3, shownFrame(anim.update(1200)));
+    TEST_ASSERT_EQUAL(2, shownFrame(anim.update(1000 + 3 * 440 + 125)));
+    TEST_ASSERT_TRUE(anim.nextChangeTimestamp(0, deadline));
+    TEST_ASSERT_EQUAL_UINT32(1000 + 3 * 440 + 140, deadline);
+
+    // one-shot playback stops on the last frame
+    anim.setLooping(false);
+    anim.reset();
+    anim.update(0);
+    TEST_ASSERT_EQUAL(3, shownFrame(anim.update(100000)));
+    TEST_ASSERT_TRUE(anim.isFinished());
+    TEST_ASSERT_FALSE(anim.nextChangeTimestamp(100000, deadline));
+}
+
+void test_animated_image_seek()
+{
+    AnimatedImage anim;
+    anim.setLooping(true);
+    anim.setFrames(markerSequence({100, 20, 20, 300}));
+
+    // 565 ms into a 440 ms loop is 125 ms into the second cycle
+    anim.seek(565);
+    TEST_ASSERT_EQUAL(2, shownFrame(anim.update(50)));
+    TEST_ASSERT_EQUAL(3, shownFrame(anim.update(65)));
+
+    // uniform durations: index and phase within the frame
+    Image a, b, c;
+    a.setPixel(0, 0, true);
+    b.setPixel(1, 0, true);
+    c.setPixel(2, 0, true);
+
+    AnimatedImage uniform;
+    uniform.setLooping(true);
+    uniform.setFrameDuration(100);
+    uniform.setFrames({a, b, c});
+    uniform.seek(250);
+    TEST_ASSERT_EQUAL(2, shownFrame(uniform.update(1000)));
+    TEST_ASSERT_EQUAL(2, shownFrame(uniform.update(1049)));
+    TEST_ASSERT_EQUAL(0, shownFrame(uniform.update(1050)));
+}
+
+void test_animated_image_staged_swap_at_frame_boundary()
+{
+    AnimatedImage anim;
+    anim.setLooping(true);
+    anim.setFrameDuration(100);
+    anim.setFrames(uniformMarkers(3));
+
+    Matrix16x16 target;
+    TEST_ASSERT_TRUE(anim.render(target, 1000));
+    TEST_ASSERT_TRUE(anim.render(target, 1100));
+    TEST_ASSERT_EQUAL(1, shownFrame(target));
+
+    // frames 0..5; the old sequence keeps playing until its frame is over
+    anim.stageFrames(uniformMarkers(6));
+    TEST_ASSERT_TRUE(anim.hasStagedFrames());
+    TEST_ASSERT_FALSE(anim.render(target, 1150));
+    TEST_ASSERT_EQUAL(1, shownFrame(target));
+
+    uint32_t deadline = 0;
+    TEST_ASSERT_TRUE(anim.nextChangeTimestamp(1150, deadline));
+    TEST_ASSERT_EQUAL_UINT32(1200, deadline);
+
+    // the new sequence starts on the old grid, even when the update is late
+    TEST_ASSERT_TRUE(anim.render(target, 1230));
+    TEST_ASSERT_FALSE(anim.hasStagedFrames());
+    TEST_ASSERT_EQUAL(0, shownFrame(target));
+    TEST_ASSERT_EQUAL(6, anim.frameCount());
+    TEST_ASSERT_TRUE(anim.nextChangeTimestamp(1230, deadline));
+    TEST_ASSERT_EQUAL_UINT32(1300, deadline);
+    TEST_ASSERT_EQUAL(4, shownFrame(anim.update(1600)));
+}
+
+void test_animated_image_staged_swap_keeps_phase()
+{
+    AnimatedImage anim;
+    anim.setLooping(true);
+    anim.setFrameDuration(100);
+    anim.setFrames(uniformMarkers(6));
+
+    anim.update(0);
+    TEST_ASSERT_EQUAL(2, shownFrame(anim.update(250)));
+
+    anim.stageFrames(uniformMarkers(8), true);
+    TEST_ASSERT_EQUAL(3, shownFrame(anim.update(310)));
+
+    uint32_t deadline = 0;
+    TEST_ASSERT_TRUE(anim.nextChangeTimestamp(310, deadline));
+    TEST_ASSERT_EQUAL_UINT32(400, deadline);
+    TEST_ASSERT_EQUAL(7, shownFrame(anim.update(700)));
+
+    // a still frame is replaced right away
+    Image still;
+    still.setPixel(9, 0, true);
+    anim.setFrames({still});
+    anim.update(800);
+    TEST_ASSERT_FALSE(anim.nextChangeTimestamp(800, deadline));
+
+    anim.stageFrames(uniformMarkers(2));
+    TEST_ASSERT_TRUE(anim.nextChangeTimestamp(810, deadline));
+    TEST_ASSERT_EQUAL_UINT32(810, deadline);
+    TEST_ASSERT_EQUAL(0, shownFrame(anim.update(810)));
+}
+
 int main(int, char**)
 {
     UNITY_BEGIN();
     RUN_TEST(test_image_pixel_access);
     RUN_TEST(test_image_draw_to_matrix);
     RUN_TEST(test_animated_image_sequence);
+    RUN_TEST(test_animated_image_next_change_timestamp);
+    RUN_TEST(test_animated_image_render_reports_changes);
+    RUN_TEST(test_animated_image_per_frame_durations);
+    RUN_TEST(test_animated_image_seek);
+    RUN_TEST(test_animated_image_staged_swap_at_frame_boundary);
+    RUN_TEST(test_animated_image_staged_swap_keeps_phase);
     return UNITY_END();
 }
 
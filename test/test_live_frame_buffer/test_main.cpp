@@ -0,0 +1,227 @@
+#include <unity.h>
+#include <config.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+
+#include "Image.h"
+#include "LiveFrameBuffer.h"
+#include "Matrix16x16.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+namespace
+{
+using FrameBytes = std::array<uint8_t, Image::kTotalBytes>;
+
+// frame `marker` lights pixel (marker % 16, marker / 16)
+FrameBytes markerFrame(int marker)
+{
+    Image image;
+    image.setPixel(marker % Image::kWidth, (marker / Image::kWidth) % Image::kHeight, true);
+
+    FrameBytes bytes{};
+    for (int y = 0; y < Image::kHeight; ++y)
+    {
+        image.getRowBytes(y, bytes.data() + y * Image::kRowBytes);
+    }
+    return bytes;
+}
+
+bool push(LiveFrameBuffer& buffer, int marker, uint32_t nowMs)
+{
+    const FrameBytes bytes = markerFrame(marker);
+    return buffer.push(bytes.data(), bytes.size(), nowMs);
+}
+
+bool shows(const Matrix16x16& matrix, int marker)
+{
+    return matrix.getPixel(marker % Image::kWidth, (marker / Image::kWidth) % Image::kHeight);
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+}
+
+void tearDown(void)
+{
+}
+
+void test_rejects_partial_frames()
+{
+    LiveFrameBuffer buffer;
+    uint8_t         bytes[Image::kTotalBytes + 1] = {};
+
+    TEST_ASSERT_FALSE(buffer.push(bytes, Image::kTotalBytes - 1, 0));
+    TEST_ASSERT_FALSE(buffer.push(bytes, Image::kTotalBytes + 1, 0));
+    TEST_ASSERT_FALSE(buffer.push(nullptr, Image::kTotalBytes, 0));
+    TEST_ASSERT_EQUAL_UINT32(3, buffer.invalid());
+    TEST_ASSERT_EQUAL_UINT32(0, buffer.received());
+
+    uint32_t deadline = 0;
+    TEST_ASSERT_FALSE(buffer.nextChangeTimestamp(0, deadline));
+}
+
+void test_drops_new_frames_when_full()
+{
+    LiveFrameBuffer buffer;
+    for (size_t i = 0; i < LiveFrameBuffer::kCapacity; ++i)
+    {
+        TEST_ASSERT_TRUE(push(buffer, static_cast<int>(i), 0));
+    }
+    TEST_ASSERT_FALSE(push(buffer, 99, 0));
+    TEST_ASSERT_EQUAL_UINT32(LiveFrameBuffer::kCapacity + 1, buffer.received());
+    TEST_ASSERT_EQUAL_UINT32(1, buffer.droppedFull());
+}
+
+void test_first_frame_waits_for_jitter_delay()
+{
+    LiveFrameBuffer buffer;
+    Matrix16x16     matrix;
+
+    push(buffer, 1, 100);
+
+    uint32_t deadline = 0;
+    TEST_ASSERT_TRUE(buffer.nextChangeTimestamp(100, deadline));
+    TEST_ASSERT_EQUAL_UINT32(100 + LIVE_JITTER_DELAY_MS, deadline);
+
+    TEST_ASSERT_FALSE(buffer.render(matrix, 100 + LIVE_JITTER_DELAY_MS - 1));
+    TEST_ASSERT_FALSE(buffer.isPlaying());
+
+    TEST_ASSERT_TRUE(buffer.render(matrix, 100 + LIVE_JITTER_DELAY_MS));
+    TEST_ASSERT_TRUE(shows(matrix, 1));
+    TEST_ASSERT_TRUE(buffer.isPlaying());
+    TEST_ASSERT_EQUAL_UINT32(LIVE_JITTER_DELAY_MS, buffer.lastLatencyMs());
+}
+
+void test_steady_stream_with_jitter_shows_every_frame()
+{
+    LiveFrameBuffer buffer;
+    Matrix16x16     matrix;
+
+    // 60 fps sender, arrivals jitter by up to 4 ms; the render loop polls every 2 ms
+    constexpr int      kFrames    = 240;
+    constexpr uint32_t kPeriodUs  = 16667;
+    const int          jitterMs[] = {0, 3, 1, 4, 2, 0, 4, 1};
+
+    int nextFrame = 0;
+    int lastShown = -1;
+    for (uint32_t now = 0; now < 5000; now += 2)
+    {
+        while (nextFrame < kFrames)
+        {
+            const uint32_t arrival = static_cast<uint32_t>(nextFrame * kPeriodUs / 1000) + jitterMs[nextFrame % 8];
+            if (arrival > now)
+                break;
+            push(buffer, nextFrame, arrival);
+            ++nextFrame;
+        }
+
+        if (buffer.render(matrix, now))
+        {
+            // frames come out in order
+            int marker = lastShown + 1;
+            while (marker < kFrames && !shows(matrix, marker))
+            {
+                ++marker;
+            }
+            TEST_ASSERT_TRUE(marker < kFrames);
+            lastShown = marker;
+        }
+    }
+
+    // the only underrun is the end of the stream
+    TEST_ASSERT_EQUAL_UINT32(kFrames, buffer.received());
+    TEST_ASSERT_EQUAL_UINT32(kFrames, buffer.shown());
+    TEST_ASSERT_EQUAL_UINT32(0, buffer.droppedFull());
+    TEST_ASSERT_EQUAL_UINT32(0, buffer.skipped());
+    TEST_ASSERT_EQUAL_UINT32(1, buffer.underruns());
+    TEST_ASSERT_EQUAL_UINT32(16, buffer.frameIntervalMs());
+    TEST_ASSERT_TRUE(buffer.maxLatencyMs() < 20);
+
+    printf("[live] 60 fps with 0-4 ms jitter: shown %u, skipped %u, underruns %u, latency avg %u ms, max %u ms\n",
+           static_cast<unsigned>(buffer.shown()), static_cast<unsigned>(buffer.skipped()),
+           static_cast<unsigned>(buffer.underruns()), static_cast<unsigned>(buffer.averageLatencyMs()),
+           static_cast<unsigned>(buffer.maxLatencyMs()));
+}
+
+void test_catches_up_after_a_burst()
+{
+    LiveFrameBuffer buffer;
+    Matrix16x16     matrix;
+
+    // a stalled connection delivers five frames at once
+    for (int i = 0; i < 5; ++i)
+    {
+        push(buffer, i, 100);
+    }
+
+    TEST_ASSERT_TRUE(buffer.render(matrix, 100 + LIVE_JITTER_DELAY_MS));
+    TEST_ASSERT_TRUE(shows(matrix, 5 - 1 - LIVE_JITTER_TARGET_FRAMES));
+    TEST_ASSERT_EQUAL_UINT32(5 - 1 - LIVE_JITTER_TARGET_FRAMES, buffer.skipped());
+    TEST_ASSERT_EQUAL_UINT32(1, buffer.shown());
+}
+
+void test_underrun_waits_for_next_burst()
+{
+    LiveFrameBuffer buffer;
+    Matrix16x16     matrix;
+
+    push(buffer, 1, 0);
+    TEST_ASSERT_TRUE(buffer.render(matrix, LIVE_JITTER_DELAY_MS));
+
+    // nothing arrived by the next step: keep the frame and stop playing
+    const uint32_t step = LIVE_JITTER_DELAY_MS + LIVE_DEFAULT_FRAME_INTERVAL_MS;
+    TEST_ASSERT_FALSE(buffer.render(matrix, step));
+    TEST_ASSERT_TRUE(shows(matrix, 1));
+    TEST_ASSERT_FALSE(buffer.isPlaying());
+    TEST_ASSERT_EQUAL_UINT32(1, buffer.underruns());
+
+    uint32_t deadline = 0;
+    TEST_ASSERT_FALSE(buffer.nextChangeTimestamp(step, deadline));
+
+    push(buffer, 2, 200);
+    TEST_ASSERT_TRUE(buffer.nextChangeTimestamp(200, deadline));
+    TEST_ASSERT_EQUAL_UINT32(200 + LIVE_JITTER_DELAY_MS, deadline);
+    TEST_ASSERT_TRUE(buffer.render(matrix, deadline));
+    TEST_ASSERT_TRUE(shows(matrix, 2));
+}
+
+void test_latency_stats_and_reset()
+{
+    LiveFrameBuffer buffer;
+    Matrix16x16     matrix;
+
+    push(buffer, 1, 0);
+    buffer.render(matrix, 10);
+    TEST_ASSERT_EQUAL_UINT32(10, buffer.lastLatencyMs());
+
+    push(buffer, 2, 12);
+    buffer.render(matrix, 10 + LIVE_DEFAULT_FRAME_INTERVAL_MS);
+    TEST_ASSERT_EQUAL_UINT32(14, buffer.lastLatencyMs());
+    TEST_ASSERT_EQUAL_UINT32(14, buffer.maxLatencyMs());
+    TEST_ASSERT_EQUAL_UINT32(12, buffer.averageLatencyMs());
+
+    buffer.resetStats();
+    TEST_ASSERT_EQUAL_UINT32(0, buffer.shown());
+    TEST_ASSERT_EQUAL_UINT32(0, buffer.received());
+    TEST_ASSERT_EQUAL_UINT32(0, buffer.maxLatencyMs());
+    TEST_ASSERT_EQUAL_UINT32(0, buffer.averageLatencyMs());
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_rejects_partial_frames);
+    RUN_TEST(test_drops_new_frames_when_full);
+    RUN_TEST(test_first_frame_waits_for_jitter_delay);
+    RUN_TEST(test_steady_stream_with_jitter_shows_every_frame);
+    RUN_TEST(test_catches_up_after_a_burst);
+    RUN_TEST(test_underrun_waits_for_next_burst);
+    RUN_TEST(test_latency_stats_and_reset);
+    return UNITY_END();
+}
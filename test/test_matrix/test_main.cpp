@@ -0,0 +1,228 @@
+#include <unity.h>
+#include <config.h>
+
+#include <cstdint>
+#include <type_traits>
+
+#include "Image.h"
+#include "Matrix.h"
+#include "Matrix16x16.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+using Matrix32x16 = Matrix<32, 16>;
+using Matrix64x16 = Matrix<64, 16>;
+using Matrix96x8  = Matrix<96, 8>;
+using Matrix16x16OnSixChips = Matrix<16, 16, 48>;
+
+// storage is picked at compile time
+static_assert(std::is_same<Matrix16x16::Row,  uint16_t>::value,      "16 columns fit uint16_t");
+static_assert(std::is_same<Matrix16x16::Word, uint32_t>::value,      "16 + 16 bits fit one 32-bit word");
+static_assert(std::is_same<Matrix32x16::Row,  uint32_t>::value,      "32 columns fit uint32_t");
+static_assert(std::is_same<Matrix32x16::Word, uint64_t>::value,      "32 + 16 bits fit uint64_t");
+static_assert(std::is_same<Matrix64x16::Row,  uint64_t>::value,      "64 columns fit uint64_t");
+static_assert(std::is_same<Matrix64x16::Word, WideBits<80>>::value,  "64 + 16 bits need a multiword");
+static_assert(std::is_same<Matrix96x8::Row,   WideBits<96>>::value,  "96 columns need a multiword");
+static_assert(std::is_same<Matrix16x16OnSixChips::Word, uint64_t>::value, "the word follows the chain length");
+static_assert(std::is_same<Matrix16x16::Word, BitStorage<SR_CHAIN_CHIPS * 8>>::value, "the panel word spans SR_CHAIN_CHIPS registers");
+static_assert(sizeof(Matrix16x16) == LED_MATRIX_ROWS * sizeof(uint16_t), "no overhead over plain rows");
+
+void setUp(void)
+{
+    gBackend = &backend;
+}
+
+void tearDown(void)
+{
+}
+
+void test_matrix_16x16_compose_row_word()
+{
+    Matrix16x16 matrix;
+    matrix.setPixel(0, 2, true);
+    matrix.setPixel(15, 2, true);
+
+    // row select above the columns, everything active-low
+    const uint32_t expected = ~((1u << (16 + 15 - 2)) | 0x8001u);
+    TEST_ASSERT_EQUAL_HEX32(expected, matrix.composeRowWord(2));
+    TEST_ASSERT_EQUAL_HEX16(0x8001u, matrix.getRowBits(2));
+}
+
+void test_matrix_32x16_pixels_and_word()
+{
+    Matrix32x16 matrix;
+    matrix.setPixel(0, 0, true);
+    matrix.setPixel(31, 0, true);
+    matrix.setPixel(20, 7, true);
+    matrix.setPixel(32, 7, true); // out of range
+
+    TEST_ASSERT_TRUE(matrix.getPixel(31, 0));
+    TEST_ASSERT_TRUE(matrix.getPixel(20, 7));
+    TEST_ASSERT_FALSE(matrix.getPixel(32, 7));
+    TEST_ASSERT_EQUAL_HEX32(0x80000001u, matrix.getRowBits(0));
+
+    const uint64_t expected = ~((uint64_t{1} << (32 + 15)) | 0x80000001ull);
+    TEST_ASSERT_TRUE(expected == matrix.composeRowWord(0));
+
+    matrix.setPixel(0, 0, false);
+    TEST_ASSERT_EQUAL_HEX32(0x00000001u, matrix.getRowBits(0));
+}
+
+void test_matrix_64x16_multiword_compose()
+{
+    Matrix64x16 matrix;
+    matrix.setPixel(0, 15, true);
+    matrix.setPixel(63, 15, true);
+
+    const WideBits<80> word = matrix.composeRowWord(15);
+
+    // low word holds x = 32..63, next word x = 0..31, then the 16 row bits
+    TEST_ASSERT_EQUAL_HEX32(~0x00000001u, word.words[0]);
+    TEST_ASSERT_EQUAL_HEX32(~0x80000000u, word.words[1]);
+    TEST_ASSERT_EQUAL_HEX32(~0x00000001u, word.words[2]);
+}
+
+void test_wide_bits_shift_carries_across_words()
+{
+    WideBits<80> bits;
+    bits.words[0] = 0x80000001u;
+    bits.words[1] = 0x80000000u;
+
+    const WideBits<80> shifted = bits << 1;
+    TEST_ASSERT_EQUAL_HEX32(0x00000002u, shifted.words[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x00000001u, shifted.words[1]);
+    TEST_ASSERT_EQUAL_HEX32(0x00000001u, shifted.words[2]);
+
+    const WideBits<80> far = bits << 36;
+    TEST_ASSERT_EQUAL_HEX32(0x00000000u, far.words[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x00000010u, far.words[1]);
+    TEST_ASSERT_EQUAL_HEX32(0x00000008u, far.words[2]);
+}
+
+void test_matrix_wide_rows_merge_and_set_all()
+{
+    Matrix96x8 a;
+    Matrix96x8 b;
+    a.setPixel(5, 3, true);
+    b.setPixel(90, 3, true);
+
+    a.merge(b);
+    TEST_ASSERT_TRUE(a.getPixel(5, 3));
+    TEST_ASSERT_TRUE(a.getPixel(90, 3));
+    TEST_ASSERT_EQUAL(2, bitops::popcount(a.getRowBits(3)));
+
+    a.setAll(true);
+    TEST_ASSERT_EQUAL(96, bitops::popcount(a.getRowBits(7)));
+    a.clear();
+    TEST_ASSERT_FALSE(bitops::any(a.getRowBits(7)));
+}
+
+void test_image_follows_matrix_size()
+{
+    TEST_ASSERT_EQUAL(LED_MATRIX_COLS, Image::kWidth);
+    TEST_ASSERT_EQUAL(LED_MATRIX_ROWS, Image::kHeight);
+
+    Image image;
+    const uint8_t bytes[Image::kRowBytes] = {0x81, 0x02};
+    image.setRowBytes(4, bytes);
+    TEST_ASSERT_TRUE(image.getPixel(0, 4));
+    TEST_ASSERT_TRUE(image.getPixel(7, 4));
+    TEST_ASSERT_TRUE(image.getPixel(14, 4));
+    TEST_ASSERT_FALSE(image.getPixel(15, 4));
+
+    uint8_t roundTrip[Image::kRowBytes] = {};
+    image.getRowBytes(4, roundTrip);
+    TEST_ASSERT_EQUAL_HEX8(0x81, roundTrip[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x02, roundTrip[1]);
+}
+
+void test_blit_or_with_clipping()
+{
+    const uint16_t square[3] = {0x7u, 0x5u, 0x7u}; // 3x3 ring
+
+    Matrix16x16 matrix;
+    matrix.blit(square, 3, 3, -1, 14, BlitOp::Or);
+
+    // only the right two columns and the top two rows stay on the panel
+    TEST_ASSERT_TRUE(matrix.getPixel(0, 14));
+    TEST_ASSERT_TRUE(matrix.getPixel(1, 14));
+    TEST_ASSERT_FALSE(matrix.getPixel(0, 15));
+    TEST_ASSERT_TRUE(matrix.getPixel(1, 15));
+    TEST_ASSERT_EQUAL_HEX16(0xC000u, matrix.getRowBits(14));
+    TEST_ASSERT_EQUAL_HEX16(0x4000u, matrix.getRowBits(15));
+
+    matrix.clear();
+    matrix.blit(square, 3, 3, 14, -2, BlitOp::Or);
+    TEST_ASSERT_EQUAL_HEX16(0x0003u, matrix.getRowBits(0));
+    TEST_ASSERT_EQUAL_HEX16(0x0000u, matrix.getRowBits(1));
+
+    matrix.clear();
+    matrix.blit(square, 3, 3, 16, 0, BlitOp::Or);
+    matrix.blit(square, 3, 3, -3, 0, BlitOp::Or);
+    TEST_ASSERT_EQUAL_HEX16(0x0000u, matrix.getRowBits(0));
+}
+
+void test_blit_ops_only_touch_covered_area()
+{
+    const uint16_t pattern[2] = {0xAu, 0x6u}; // 4 wide: 1010, 0110
+
+    Matrix16x16 base;
+    base.setRowBits(0, 0xFFFFu);
+    base.setRowBits(1, 0x0F00u);
+
+    Matrix16x16 copy = base;
+    copy.blit(pattern, 4, 2, 4, 0, BlitOp::Copy);
+    TEST_ASSERT_EQUAL_HEX16(0xFAFFu, copy.getRowBits(0));
+    TEST_ASSERT_EQUAL_HEX16(0x0600u, copy.getRowBits(1));
+
+    Matrix16x16 andResult = base;
+    andResult.blit(pattern, 4, 2, 4, 0, BlitOp::And);
+    TEST_ASSERT_EQUAL_HEX16(0xFAFFu, andResult.getRowBits(0));
+    TEST_ASSERT_EQUAL_HEX16(0x0600u, andResult.getRowBits(1));
+
+    Matrix16x16 xorResult = base;
+    xorResult.blit(pattern, 4, 2, 4, 0, BlitOp::Xor);
+    TEST_ASSERT_EQUAL_HEX16(0xF5FFu, xorResult.getRowBits(0));
+    TEST_ASSERT_EQUAL_HEX16(0x0900u, xorResult.getRowBits(1));
+
+    Matrix16x16 andNotResult = base;
+    andNotResult.blit(pattern, 4, 2, 4, 0, BlitOp::AndNot);
+    TEST_ASSERT_EQUAL_HEX16(0xF5FFu, andNotResult.getRowBits(0));
+    TEST_ASSERT_EQUAL_HEX16(0x0900u, andNotResult.getRowBits(1));
+}
+
+void test_blit_matrix_source_and_wide_rows()
+{
+    Matrix16x16 source;
+    source.setPixel(0, 0, true);
+    source.setPixel(15, 15, true);
+
+    Matrix16x16 target;
+    target.blit(source, 2, 1, BlitOp::Or);
+    TEST_ASSERT_TRUE(target.getPixel(2, 1));
+    TEST_ASSERT_FALSE(target.getPixel(15, 15));
+
+    // multiword rows take the per-pixel path with identical results
+    const uint16_t bar[1] = {0xFFFFu};
+    Matrix96x8 wide;
+    wide.blit(bar, 16, 1, 88, 7, BlitOp::Or);
+    TEST_ASSERT_EQUAL(8, bitops::popcount(wide.getRowBits(7)));
+    TEST_ASSERT_TRUE(wide.getPixel(95, 7));
+    TEST_ASSERT_FALSE(wide.getPixel(87, 7));
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_matrix_16x16_compose_row_word);
+    RUN_TEST(test_matrix_32x16_pixels_and_word);
+    RUN_TEST(test_matrix_64x16_multiword_compose);
+    RUN_TEST(test_wide_bits_shift_carries_across_words);
+    RUN_TEST(test_matrix_wide_rows_merge_and_set_all);
+    RUN_TEST(test_image_follows_matrix_size);
+    RUN_TEST(test_blit_or_with_clipping);
+    RUN_TEST(test_blit_ops_only_touch_covered_area);
+    RUN_TEST(test_blit_matrix_source_and_wide_rows);
+    return UNITY_END();
+}
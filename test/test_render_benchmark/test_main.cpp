@@ -0,0 +1,191 @@
+#include <unity.h>
+#include <config.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "AnimatedText.h"
+#include "Image.h"
+#include "Matrix16x16.h"
+#include "font8x8_basic.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+namespace
+{
+constexpr int   kIterations = 20000;
+const char*     kMessage    = "Hello World  ";
+
+// the renderer before the blit API: one bounds-checked setPixel per lit sub-pixel
+void drawGlyphPerPixel(Matrix16x16& matrix, const uint8_t* glyph, int offsetX, int offsetY, int scale)
+{
+    for (int row = 0; row < 8; ++row)
+    {
+        for (int col = 0; col < 8; ++col)
+        {
+            if (((glyph[row] >> col) & 0x1u) == 0u)
+                continue;
+
+            for (int dy = 0; dy < scale; ++dy)
+            {
+                for (int dx = 0; dx < scale; ++dx)
+                {
+                    matrix.setPixel(offsetX + col * scale + dx, offsetY + row * scale + dy, true);
+                }
+            }
+        }
+    }
+}
+
+Matrix16x16 scrollFramePerPixel(const std::string& text, int offset, int scale, int offsetY = 0, bool looping = true)
+{
+    Matrix16x16 matrix;
+    const int   glyphWidth = 8 * scale;
+    size_t      index      = static_cast<size_t>(offset / glyphWidth);
+    if (!looping && index >= text.size())
+        return matrix;
+
+    for (int drawX = -(offset % glyphWidth); drawX < LED_MATRIX_COLS; drawX += glyphWidth)
+    {
+        const char c = (looping || index < text.size()) ? text[index % text.size()] : ' ';
+        drawGlyphPerPixel(matrix, font8x8_basic[static_cast<uint8_t>(c)], drawX, offsetY, scale);
+        ++index;
+    }
+    return matrix;
+}
+
+template <typename Fn>
+double nanosecondsPerCall(Fn&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i)
+    {
+        fn(i);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / kIterations;
+}
+
+volatile uint32_t gSink = 0;
+
+void consume(const Matrix16x16& matrix)
+{
+    gSink = gSink + matrix.composeRowWord(7);
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+}
+
+void tearDown(void)
+{
+}
+
+void test_blit_text_matches_per_pixel_rendering()
+{
+    AnimatedText text;
+    text.setVerticalAlignment(AnimatedText::VerticalAlignment::Full);
+    text.setAnimationMode(AnimatedText::AnimationMode::Scroll);
+    text.setFrameDuration(1);
+    text.setLooping(true);
+    text.setText(kMessage);
+
+    const std::string message(kMessage);
+    for (int frame = 0; frame < static_cast<int>(message.size()) * 16; ++frame)
+    {
+        const Matrix16x16 actual   = text.update(static_cast<uint32_t>(frame));
+        const Matrix16x16 expected = scrollFramePerPixel(message, frame, 2);
+        for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+        {
+            TEST_ASSERT_EQUAL_HEX16(expected.getRowBits(y), actual.getRowBits(y));
+        }
+    }
+}
+
+void test_strip_matches_per_pixel_rendering_lower_half_once()
+{
+    AnimatedText text;
+    text.setVerticalAlignment(AnimatedText::VerticalAlignment::LowerHalf);
+    text.setAnimationMode(AnimatedText::AnimationMode::Scroll);
+    text.setFrameDuration(1);
+    text.setLooping(false);
+    text.setText("Hi!");
+
+    // one pass plus a few frames after the text has left the panel
+    for (int frame = 0; frame < 3 * 8 + 4; ++frame)
+    {
+        const Matrix16x16 actual   = text.update(static_cast<uint32_t>(frame));
+        const Matrix16x16 expected = scrollFramePerPixel("Hi!", frame, 1, LED_MATRIX_ROWS - 8, false);
+        for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+        {
+            TEST_ASSERT_EQUAL_HEX16(expected.getRowBits(y), actual.getRowBits(y));
+        }
+    }
+}
+
+void test_benchmark_text_frame()
+{
+    const std::string message(kMessage);
+
+    const double perPixelNs = nanosecondsPerCall([&](int i) {
+        consume(scrollFramePerPixel(message, i % (16 * static_cast<int>(message.size())), 2));
+    });
+
+    AnimatedText text;
+    text.setVerticalAlignment(AnimatedText::VerticalAlignment::Full);
+    text.setAnimationMode(AnimatedText::AnimationMode::Scroll);
+    text.setFrameDuration(1);
+    text.setLooping(true);
+    text.setText(kMessage);
+
+    const double blitNs = nanosecondsPerCall([&](int i) {
+        consume(text.update(static_cast<uint32_t>(i)));
+    });
+
+    printf("[bench] scroll frame: per-pixel %.0f ns, AnimatedText %.0f ns (%.1fx)\n", perPixelNs, blitNs, perPixelNs / blitNs);
+}
+
+void test_benchmark_image_frame()
+{
+    Image image;
+    for (int i = 0; i < LED_MATRIX_ROWS; ++i)
+    {
+        image.setPixel(i, i, true);
+        image.setPixel(LED_MATRIX_COLS - 1 - i, i, true);
+    }
+
+    const double perPixelNs = nanosecondsPerCall([&](int) {
+        Matrix16x16 matrix;
+        for (int y = 0; y < Image::kHeight; ++y)
+        {
+            for (int x = 0; x < Image::kWidth; ++x)
+            {
+                matrix.setPixel(x, y, image.getPixel(x, y));
+            }
+        }
+        consume(matrix);
+    });
+
+    const double blitNs = nanosecondsPerCall([&](int) {
+        Matrix16x16 matrix;
+        image.draw(matrix);
+        consume(matrix);
+    });
+
+    printf("[bench] image frame: per-pixel %.0f ns, blit %.0f ns (%.1fx)\n", perPixelNs, blitNs, perPixelNs / blitNs);
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_blit_text_matches_per_pixel_rendering);
+    RUN_TEST(test_strip_matches_per_pixel_rendering_lower_half_once);
+    RUN_TEST(test_benchmark_text_frame);
+    RUN_TEST(test_benchmark_image_frame);
+    return UNITY_END();
+}
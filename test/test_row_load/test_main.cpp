@@ -0,0 +1,193 @@
+#include <unity.h>
+#include <config.h>
+
+#include <cstdint>
+
+#include "GrayscaleMatrix.h"
+#include "Matrix16x16.h"
+#include "ScanBuffer.h"
+#include "ScanEngine.h"
+#include "ShiftRegisterChain.h"
+
+MockBackend*       gBackend = nullptr;
+MockBackend        backend;
+ShiftRegisterChain shiftRegister;
+
+namespace
+{
+constexpr uint32_t kRowPeriodUs = 520;
+
+// run the ISR state machine on the virtual clock for one frame
+void runFrame(ScanEngine& engine)
+{
+    int framesStarted = 0;
+    for (;;)
+    {
+        ScanEngine::Step step = engine.step();
+        if (step.frameStart && ++framesStarted > 1)
+            break;
+
+        shiftRegister.writeWord(step.word);
+        backend.delayMicroseconds(step.durationUs);
+    }
+}
+
+// row y lights the first `y + 1` LEDs
+Matrix16x16 staircase()
+{
+    Matrix16x16 matrix;
+    for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+    {
+        for (int x = 0; x <= y && x < LED_MATRIX_COLS; ++x)
+        {
+            matrix.setPixel(x, y, true);
+        }
+    }
+    return matrix;
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+    backend.reset();
+    shiftRegister.begin();
+    backend.resetTiming();
+}
+
+void tearDown(void)
+{
+}
+
+void test_row_load_counts_lit_leds()
+{
+    ScanBuffer scanBuffer;
+    scanBuffer.build(staircase());
+
+    for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+    {
+        TEST_ASSERT_EQUAL(y + 1, scanBuffer.rowLoad(0, y));
+    }
+}
+
+void test_row_load_disabled_keeps_nominal_timing()
+{
+    ScanBuffer scanBuffer;
+    scanBuffer.setRowLoadCompensation(false);
+    scanBuffer.build(staircase());
+    scanBuffer.setTiming(kRowPeriodUs, 16, 32);
+
+    for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+    {
+        TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs / 2, scanBuffer.planeOnTimeUs(0, y));
+        TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs / 2, scanBuffer.rowOffTimeUs(y));
+    }
+}
+
+void test_row_load_default_curve_is_monotonic()
+{
+    const ScanBuffer::RowLoadCurve curve = ScanBuffer::defaultRowLoadCurve();
+
+    TEST_ASSERT_EQUAL_UINT16(ROW_LOAD_SPARSE_GAIN, curve[1]);
+    TEST_ASSERT_EQUAL_UINT16(ScanBuffer::kUnityGain, curve[LED_MATRIX_COLS]);
+    for (int lit = 2; lit <= LED_MATRIX_COLS; ++lit)
+    {
+        TEST_ASSERT_TRUE(curve[lit] >= curve[lit - 1]);
+    }
+}
+
+void test_row_load_scales_on_time_and_keeps_period()
+{
+    ScanBuffer scanBuffer;
+    scanBuffer.setRowLoadCompensation(true);
+    scanBuffer.build(staircase());
+    scanBuffer.setTiming(kRowPeriodUs, 1, 1);
+
+    const ScanBuffer::RowLoadCurve& curve = scanBuffer.getRowLoadCurve();
+    for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+    {
+        const uint32_t expectedUs = (kRowPeriodUs * curve[y + 1]) / ScanBuffer::kUnityGain;
+        TEST_ASSERT_EQUAL_UINT32(expectedUs, scanBuffer.planeOnTimeUs(0, y));
+        TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, scanBuffer.planeOnTimeUs(0, y) + scanBuffer.rowOffTimeUs(y));
+    }
+
+    // full row runs at the nominal on-time, a single LED is cut back to the sparse gain
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, scanBuffer.planeOnTimeUs(0, LED_MATRIX_ROWS - 1));
+    TEST_ASSERT_EQUAL_UINT32((kRowPeriodUs * ROW_LOAD_SPARSE_GAIN) / 256, scanBuffer.planeOnTimeUs(0, 0));
+}
+
+void test_row_load_custom_curve_never_exceeds_period()
+{
+    ScanBuffer::RowLoadCurve boost{};
+    boost.fill(512);
+
+    ScanBuffer scanBuffer;
+    scanBuffer.setRowLoadCompensation(true);
+    scanBuffer.setRowLoadCurve(boost);
+    scanBuffer.build(staircase());
+
+    scanBuffer.setTiming(kRowPeriodUs, 8, 32);
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs / 2, scanBuffer.planeOnTimeUs(0, 3));
+
+    scanBuffer.setTiming(kRowPeriodUs, 24, 32);
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, scanBuffer.planeOnTimeUs(0, 3));
+    TEST_ASSERT_EQUAL_UINT32(0, scanBuffer.rowOffTimeUs(3));
+}
+
+void test_row_load_applies_per_bcm_plane()
+{
+    GrayscaleMatrix matrix(4);
+    for (int x = 0; x < LED_MATRIX_COLS; ++x)
+    {
+        matrix.setPixel(x, 0, 1); // plane 0 fully loaded
+    }
+    matrix.setPixel(0, 0, 3);     // plane 1 carries one LED
+
+    ScanBuffer scanBuffer;
+    scanBuffer.setRowLoadCompensation(true);
+    scanBuffer.build(matrix);
+    scanBuffer.setTiming(kRowPeriodUs, 1, 1);
+
+    // nominal plane times are 2^k / 15 of the row period, rounded
+    const uint32_t plane0Us = (kRowPeriodUs + 7u) / 15u;
+    const uint32_t plane1Us = (2u * kRowPeriodUs + 7u) / 15u;
+    TEST_ASSERT_EQUAL(LED_MATRIX_COLS, scanBuffer.rowLoad(0, 0));
+    TEST_ASSERT_EQUAL(1, scanBuffer.rowLoad(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(plane0Us, scanBuffer.planeOnTimeUs(0, 0));
+    TEST_ASSERT_EQUAL_UINT32((plane1Us * ROW_LOAD_SPARSE_GAIN) / 256, scanBuffer.planeOnTimeUs(1, 0));
+}
+
+void test_row_load_luminance_on_virtual_clock()
+{
+    ScanEngine  engine;
+    ScanBuffer& buffer = engine.backBuffer();
+    buffer.setRowLoadCompensation(true);
+    buffer.build(staircase());
+    buffer.setTiming(kRowPeriodUs, 1, 1);
+    engine.queueFrame();
+
+    runFrame(engine);
+
+    // lit time of the first LED of each row follows the row's gain
+    uint64_t previousNs = 0;
+    for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+    {
+        const uint64_t litNs = backend.ledOnTimeNs(0, y);
+        TEST_ASSERT_TRUE(litNs >= previousNs);
+        previousNs = litNs;
+    }
+    TEST_ASSERT_TRUE(backend.ledOnTimeNs(0, 0) < backend.ledOnTimeNs(0, LED_MATRIX_ROWS - 1));
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_row_load_counts_lit_leds);
+    RUN_TEST(test_row_load_disabled_keeps_nominal_timing);
+    RUN_TEST(test_row_load_default_curve_is_monotonic);
+    RUN_TEST(test_row_load_scales_on_time_and_keeps_period);
+    RUN_TEST(test_row_load_custom_curve_never_exceeds_period);
+    RUN_TEST(test_row_load_applies_per_bcm_plane);
+    RUN_TEST(test_row_load_luminance_on_virtual_clock);
+    return UNITY_END();
+}
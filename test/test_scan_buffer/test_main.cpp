@@ -0,0 +1,125 @@
+#include <unity.h>
+#include <config.h>
+
+#include <cstdint>
+
+#include "Matrix16x16.h"
+#include "ScanBuffer.h"
+#include "ShiftRegisterChain.h"
+
+MockBackend*       gBackend = nullptr;
+MockBackend        backend;
+ShiftRegisterChain shiftRegister;
+
+void setUp(void)
+{
+    gBackend = &backend;
+    shiftRegister.begin();
+}
+
+void tearDown(void)
+{
+}
+
+namespace
+{
+// latch every row once via the per-row path and once via the scan buffer
+void assertLatchedWordsMatch(const Matrix16x16& matrix)
+{
+    ScanBuffer scanBuffer;
+    scanBuffer.build(matrix);
+
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        backend.reset();
+        shiftRegister.writeWord(matrix.composeRowWord(row));
+        const MockBackend::Word expected = backend.latchedWord;
+
+        backend.reset();
+        shiftRegister.writeWord(scanBuffer.rowWord(row));
+
+        TEST_ASSERT_EQUAL(SR_CHAIN_CHIPS * 8, backend.bitCount);
+        TEST_ASSERT_EQUAL_HEX32(expected, backend.latchedWord);
+    }
+}
+} // namespace
+
+void test_scan_buffer_starts_blank()
+{
+    ScanBuffer scanBuffer;
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        TEST_ASSERT_EQUAL_HEX32(ScanBuffer::kBlankWord, scanBuffer.rowWord(row));
+    }
+}
+
+void test_scan_buffer_matches_empty_and_full()
+{
+    Matrix16x16 matrix;
+
+    matrix.clear();
+    assertLatchedWordsMatch(matrix);
+
+    matrix.setAll(true);
+    assertLatchedWordsMatch(matrix);
+}
+
+void test_scan_buffer_matches_running_light()
+{
+    Matrix16x16 matrix;
+
+    for (int position = 0; position < LED_MATRIX_ROWS * LED_MATRIX_COLS; ++position)
+    {
+        matrix.clear();
+        matrix.setPixel(position % LED_MATRIX_COLS, position / LED_MATRIX_COLS, true);
+        assertLatchedWordsMatch(matrix);
+    }
+}
+
+void test_scan_buffer_matches_pseudo_random_frames()
+{
+    Matrix16x16 matrix;
+    uint32_t    state = 0x12345678u;
+
+    for (int frame = 0; frame < 64; ++frame)
+    {
+        for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+        {
+            // xorshift32
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            matrix.setRowBits(row, static_cast<uint16_t>(state));
+        }
+        assertLatchedWordsMatch(matrix);
+    }
+}
+
+void test_scan_buffer_rebuild_replaces_previous_frame()
+{
+    Matrix16x16 matrix;
+    ScanBuffer  scanBuffer;
+
+    matrix.setAll(true);
+    scanBuffer.build(matrix);
+
+    matrix.clear();
+    matrix.setPixel(3, 7, true);
+    scanBuffer.build(matrix);
+
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        TEST_ASSERT_EQUAL_HEX32(matrix.composeRowWord(row), scanBuffer.rowWord(row));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_scan_buffer_starts_blank);
+    RUN_TEST(test_scan_buffer_matches_empty_and_full);
+    RUN_TEST(test_scan_buffer_matches_running_light);
+    RUN_TEST(test_scan_buffer_matches_pseudo_random_frames);
+    RUN_TEST(test_scan_buffer_rebuild_replaces_previous_frame);
+    return UNITY_END();
+}
@@ -0,0 +1,163 @@
+#include <unity.h>
+#include <config.h>
+
+#include <cstdint>
+
+#include "GrayscaleMatrix.h"
+#include "Matrix16x16.h"
+#include "ScanBuffer.h"
+#include "ScanEngine.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+namespace
+{
+constexpr uint32_t kRowPeriodUs = 520;
+
+void queueMonochrome(ScanEngine& engine, const Matrix16x16& matrix, uint32_t duty, uint32_t scale)
+{
+    ScanBuffer& buffer = engine.backBuffer();
+    buffer.build(matrix);
+    buffer.setTiming(kRowPeriodUs, duty, scale);
+    engine.queueFrame();
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+}
+
+void tearDown(void)
+{
+}
+
+void test_engine_steps_rows_with_on_and_off_phase()
+{
+    Matrix16x16 matrix;
+    matrix.setPixel(2, 0, true);
+    matrix.setPixel(5, 9, true);
+
+    ScanEngine engine;
+    queueMonochrome(engine, matrix, 8, 32);
+    TEST_ASSERT_TRUE(engine.hasPendingFrame());
+
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        ScanEngine::Step on = engine.step();
+        TEST_ASSERT_EQUAL(row == 0, on.frameStart);
+        TEST_ASSERT_EQUAL(row, on.row);
+        TEST_ASSERT_EQUAL_HEX32(matrix.composeRowWord(row), on.word);
+        TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs / 4, on.durationUs);
+
+        ScanEngine::Step off = engine.step();
+        TEST_ASSERT_FALSE(off.frameStart);
+        TEST_ASSERT_EQUAL(row, off.row);
+        TEST_ASSERT_EQUAL_HEX32(ScanBuffer::kBlankWord, off.word);
+        TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs - kRowPeriodUs / 4, off.durationUs);
+    }
+
+    TEST_ASSERT_FALSE(engine.hasPendingFrame());
+    TEST_ASSERT_TRUE(engine.step().frameStart);
+}
+
+void test_engine_skips_zero_length_phases()
+{
+    Matrix16x16 matrix;
+    matrix.setAll(true);
+
+    ScanEngine engine;
+
+    // full brightness: no blank phase
+    queueMonochrome(engine, matrix, 1, 1);
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        ScanEngine::Step step = engine.step();
+        TEST_ASSERT_EQUAL_HEX32(matrix.composeRowWord(row), step.word);
+        TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, step.durationUs);
+    }
+
+    // zero brightness: blank phase only
+    queueMonochrome(engine, matrix, 0, 32);
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        ScanEngine::Step step = engine.step();
+        TEST_ASSERT_EQUAL_HEX32(ScanBuffer::kBlankWord, step.word);
+        TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, step.durationUs);
+    }
+}
+
+void test_engine_adopts_frames_only_at_frame_start()
+{
+    Matrix16x16 first;
+    first.setAll(true);
+    Matrix16x16 second;
+    second.clear();
+
+    ScanEngine engine;
+    queueMonochrome(engine, first, 1, 1);
+
+    engine.step(); // row 0 of the first frame
+    queueMonochrome(engine, second, 1, 1);
+
+    for (int row = 1; row < LED_MATRIX_ROWS; ++row)
+    {
+        ScanEngine::Step step = engine.step();
+        TEST_ASSERT_FALSE(step.frameStart);
+        TEST_ASSERT_EQUAL_HEX32(first.composeRowWord(row), step.word);
+    }
+
+    ScanEngine::Step step = engine.step();
+    TEST_ASSERT_TRUE(step.frameStart);
+    TEST_ASSERT_EQUAL_HEX32(second.composeRowWord(0), step.word);
+    TEST_ASSERT_FALSE(engine.hasPendingFrame());
+}
+
+void test_engine_frame_period_is_constant_with_bcm()
+{
+    GrayscaleMatrix matrix(5);
+    matrix.setPixel(1, 1, 21);
+
+    ScanEngine  engine;
+    ScanBuffer& buffer = engine.backBuffer();
+    buffer.build(matrix);
+    buffer.setTiming(kRowPeriodUs, 3, 4);
+    engine.queueFrame();
+
+    uint64_t frameUs    = 0;
+    int      frameSteps = 0;
+    ScanEngine::Step step = engine.step();
+    TEST_ASSERT_TRUE(step.frameStart);
+
+    do
+    {
+        frameUs += step.durationUs;
+        ++frameSteps;
+        step = engine.step();
+    } while (!step.frameStart);
+
+    TEST_ASSERT_EQUAL_UINT64(static_cast<uint64_t>(kRowPeriodUs) * LED_MATRIX_ROWS, frameUs);
+    TEST_ASSERT_EQUAL(LED_MATRIX_ROWS * (5 + 1), frameSteps);
+}
+
+void test_engine_without_frame_reports_empty_step()
+{
+    ScanEngine engine;
+    ScanEngine::Step step = engine.step();
+
+    TEST_ASSERT_EQUAL_HEX32(ScanBuffer::kBlankWord, step.word);
+    TEST_ASSERT_EQUAL_UINT32(0, step.durationUs);
+    TEST_ASSERT_TRUE(step.frameStart);
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_engine_steps_rows_with_on_and_off_phase);
+    RUN_TEST(test_engine_skips_zero_length_phases);
+    RUN_TEST(test_engine_adopts_frames_only_at_frame_start);
+    RUN_TEST(test_engine_frame_period_is_constant_with_bcm);
+    RUN_TEST(test_engine_without_frame_reports_empty_step);
+    return UNITY_END();
+}
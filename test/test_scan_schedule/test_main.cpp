@@ -0,0 +1,218 @@
+#include <unity.h>
+#include <config.h>
+
+#include <cstdint>
+
+#include "Matrix16x16.h"
+#include "ScanBuffer.h"
+#include "ScanEngine.h"
+#include "ShiftRegisterChain.h"
+
+MockBackend*       gBackend = nullptr;
+MockBackend        backend;
+ShiftRegisterChain shiftRegister;
+
+namespace
+{
+constexpr uint32_t kRowPeriodUs   = 520;
+constexpr uint32_t kFramePeriodUs = kRowPeriodUs * LED_MATRIX_ROWS;
+constexpr uint32_t kMaxRowOnUs    = (kFramePeriodUs * SCAN_MAX_ROW_DUTY_PERCENT) / 100u;
+
+// one bit per chain output at the configured SPI clock
+constexpr uint64_t kWordTransferNs = (SR_CHAIN_CHIPS * 8ull * 1000000000ull) / SHIFTREG_SPI_FREQUENCY_HZ;
+
+// run the ISR state machine on the virtual clock for one frame
+void runFrame(ScanEngine& engine)
+{
+    int framesStarted = 0;
+    for (;;)
+    {
+        ScanEngine::Step step = engine.step();
+        if (step.frameStart && ++framesStarted > 1)
+            break;
+
+        shiftRegister.writeWord(step.word);
+        backend.delayMicroseconds(step.durationUs);
+    }
+}
+
+// rows 3 and 10 carry one LED each, everything else is blank
+Matrix16x16 twoRows()
+{
+    Matrix16x16 matrix;
+    matrix.setPixel(2, 3, true);
+    matrix.setPixel(7, 10, true);
+    return matrix;
+}
+
+void setUpBuffer(ScanBuffer& scanBuffer, ScanSchedule schedule, const Matrix16x16& matrix)
+{
+    scanBuffer.setRowLoadCompensation(false);
+    scanBuffer.setSchedule(schedule);
+    scanBuffer.build(matrix);
+    scanBuffer.setTiming(kRowPeriodUs, 1, 1);
+}
+
+ScanBuffer makeBuffer(ScanSchedule schedule, const Matrix16x16& matrix)
+{
+    ScanBuffer scanBuffer;
+    setUpBuffer(scanBuffer, schedule, matrix);
+    return scanBuffer;
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+    backend.reset();
+    shiftRegister.begin();
+    backend.resetTiming();
+}
+
+void tearDown(void)
+{
+}
+
+void test_schedule_all_rows_visits_blank_rows()
+{
+    const ScanBuffer scanBuffer = makeBuffer(ScanSchedule::AllRows, twoRows());
+
+    TEST_ASSERT_EQUAL(LED_MATRIX_ROWS, scanBuffer.scanRowCount());
+    for (int index = 0; index < LED_MATRIX_ROWS; ++index)
+    {
+        TEST_ASSERT_EQUAL(index, scanBuffer.scanRowAt(index));
+    }
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, scanBuffer.effectiveRowPeriodUs());
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, scanBuffer.planeOnTimeUs(0, 3));
+}
+
+void test_schedule_skips_blank_rows()
+{
+    const ScanBuffer scanBuffer = makeBuffer(ScanSchedule::ActiveRowsFastRefresh, twoRows());
+
+    TEST_ASSERT_EQUAL(2, scanBuffer.scanRowCount());
+    TEST_ASSERT_EQUAL(3, scanBuffer.scanRowAt(0));
+    TEST_ASSERT_EQUAL(10, scanBuffer.scanRowAt(1));
+}
+
+void test_schedule_blank_frame_keeps_full_scan()
+{
+    const ScanBuffer scanBuffer = makeBuffer(ScanSchedule::ActiveRowsSharedPeriod, Matrix16x16());
+
+    TEST_ASSERT_EQUAL(LED_MATRIX_ROWS, scanBuffer.scanRowCount());
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, scanBuffer.effectiveRowPeriodUs());
+}
+
+void test_schedule_fast_refresh_shortens_frame()
+{
+    ScanEngine  engine;
+    ScanBuffer& scanBuffer = engine.backBuffer();
+    setUpBuffer(scanBuffer, ScanSchedule::ActiveRowsFastRefresh, twoRows());
+    scanBuffer.setTiming(kRowPeriodUs, 1, 2);
+    engine.queueFrame();
+
+    TEST_ASSERT_EQUAL_UINT32(2u * kRowPeriodUs, scanBuffer.framePeriodUs());
+
+    runFrame(engine);
+
+    // two rows at the nominal period, each adding two word transfers; half on-time is the duty limit
+    TEST_ASSERT_EQUAL_UINT64(2u * kRowPeriodUs * 1000u + 2u * 2u * kWordTransferNs, backend.nowNs);
+    TEST_ASSERT_EQUAL_UINT64((kRowPeriodUs / 2) * 1000u + kWordTransferNs, backend.ledOnTimeNs(2, 3));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.25f, backend.luminance(7, 10));
+}
+
+void test_schedule_fast_refresh_pads_frame_to_duty_limit()
+{
+    ScanEngine  engine;
+    ScanBuffer& scanBuffer = engine.backBuffer();
+    setUpBuffer(scanBuffer, ScanSchedule::ActiveRowsFastRefresh, twoRows());
+    engine.queueFrame();
+
+    // full on-time would light each of the two rows half of the frame
+    const uint32_t paddedFrameUs = (kRowPeriodUs * 100u) / SCAN_MAX_ROW_DUTY_PERCENT;
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, scanBuffer.planeOnTimeUs(0, 3));
+    TEST_ASSERT_EQUAL_UINT32(paddedFrameUs, scanBuffer.framePeriodUs());
+    TEST_ASSERT_EQUAL_UINT32(paddedFrameUs / 2 - kRowPeriodUs, scanBuffer.rowOffTimeUs(3));
+    TEST_ASSERT_EQUAL_UINT32(paddedFrameUs / 2 - kRowPeriodUs, scanBuffer.rowOffTimeUs(10));
+
+    runFrame(engine);
+
+    TEST_ASSERT_EQUAL_UINT64(static_cast<uint64_t>(paddedFrameUs) * 1000u + 2u * 2u * kWordTransferNs, backend.nowNs);
+    TEST_ASSERT_EQUAL_UINT64(kRowPeriodUs * 1000u + kWordTransferNs, backend.ledOnTimeNs(2, 3));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, SCAN_MAX_ROW_DUTY_PERCENT / 100.0f, backend.luminance(7, 10));
+}
+
+void test_schedule_fast_refresh_single_row_duty()
+{
+    Matrix16x16 matrix;
+    matrix.setPixel(5, 6, true);
+
+    ScanEngine  engine;
+    ScanBuffer& scanBuffer = engine.backBuffer();
+    setUpBuffer(scanBuffer, ScanSchedule::ActiveRowsFastRefresh, matrix);
+    engine.queueFrame();
+
+    TEST_ASSERT_EQUAL(1, scanBuffer.scanRowCount());
+    TEST_ASSERT_EQUAL_UINT32((kRowPeriodUs * 100u) / SCAN_MAX_ROW_DUTY_PERCENT, scanBuffer.framePeriodUs());
+
+    runFrame(engine);
+
+    // a lone row may not run at 100 % duty; the blank word transfer is the only excess
+    const double duty      = static_cast<double>(backend.ledOnTimeNs(5, 6)) / static_cast<double>(backend.nowNs);
+    const double dutyLimit = SCAN_MAX_ROW_DUTY_PERCENT / 100.0
+                           + static_cast<double>(kWordTransferNs) / static_cast<double>(backend.nowNs);
+    TEST_ASSERT_TRUE(duty <= dutyLimit);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, SCAN_MAX_ROW_DUTY_PERCENT / 100.0f, backend.luminance(5, 6));
+}
+
+void test_schedule_shared_period_keeps_frame_and_caps_duty()
+{
+    ScanEngine  engine;
+    ScanBuffer& scanBuffer = engine.backBuffer();
+    setUpBuffer(scanBuffer, ScanSchedule::ActiveRowsSharedPeriod, twoRows());
+    engine.queueFrame();
+
+    TEST_ASSERT_EQUAL_UINT32(kFramePeriodUs / 2, scanBuffer.effectiveRowPeriodUs());
+    TEST_ASSERT_EQUAL_UINT32(kMaxRowOnUs, scanBuffer.planeOnTimeUs(0, 3));
+    TEST_ASSERT_EQUAL_UINT32(kFramePeriodUs / 2 - kMaxRowOnUs, scanBuffer.rowOffTimeUs(3));
+
+    runFrame(engine);
+
+    // refresh rate unchanged, but each lit row gets the duty cap instead of 1/16
+    TEST_ASSERT_EQUAL_UINT64(static_cast<uint64_t>(kFramePeriodUs) * 1000u + 2u * 2u * kWordTransferNs, backend.nowNs);
+    TEST_ASSERT_EQUAL_UINT64(kMaxRowOnUs * 1000u + kWordTransferNs, backend.ledOnTimeNs(2, 3));
+    TEST_ASSERT_EQUAL_UINT64(kMaxRowOnUs * 1000u + kWordTransferNs, backend.ledOnTimeNs(7, 10));
+    TEST_ASSERT_EQUAL_UINT64(0, backend.ledOnTimeNs(2, 4));
+}
+
+void test_schedule_engine_steps_active_rows_only()
+{
+    ScanEngine  engine;
+    ScanBuffer& buffer = engine.backBuffer();
+    buffer.setSchedule(ScanSchedule::ActiveRowsFastRefresh);
+    buffer.build(twoRows());
+    buffer.setTiming(kRowPeriodUs, 1, 2);
+    engine.queueFrame();
+
+    const int expectedRows[] = {3, 3, 10, 10, 3};
+    for (int expectedRow : expectedRows)
+    {
+        const ScanEngine::Step step = engine.step();
+        TEST_ASSERT_EQUAL(expectedRow, step.row);
+        TEST_ASSERT_TRUE(step.durationUs > 0);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_schedule_all_rows_visits_blank_rows);
+    RUN_TEST(test_schedule_skips_blank_rows);
+    RUN_TEST(test_schedule_blank_frame_keeps_full_scan);
+    RUN_TEST(test_schedule_fast_refresh_shortens_frame);
+    RUN_TEST(test_schedule_fast_refresh_pads_frame_to_duty_limit);
+    RUN_TEST(test_schedule_fast_refresh_single_row_duty);
+    RUN_TEST(test_schedule_shared_period_keeps_frame_and_caps_duty);
+    RUN_TEST(test_schedule_engine_steps_active_rows_only);
+    return UNITY_END();
+}
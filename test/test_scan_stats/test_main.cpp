@@ -0,0 +1,176 @@
+#include <unity.h>
+#include <config.h>
+
+#include <cstdint>
+
+#include "Matrix16x16.h"
+#include "ScanEngine.h"
+#include "ScanStats.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+namespace
+{
+constexpr uint32_t kRowPeriodUs = 520;
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+    backend.reset();
+}
+
+void tearDown(void)
+{
+}
+
+void test_histogram_bucket_index()
+{
+    constexpr int kCenter = JitterHistogram::kBucketCount / 2;
+    constexpr int kWidth  = JitterHistogram::kBucketWidthUs;
+
+    TEST_ASSERT_EQUAL(kCenter, JitterHistogram::bucketIndex(0));
+    TEST_ASSERT_EQUAL(kCenter, JitterHistogram::bucketIndex(kWidth - 1));
+    TEST_ASSERT_EQUAL(kCenter + 1, JitterHistogram::bucketIndex(kWidth));
+    TEST_ASSERT_EQUAL(kCenter - 1, JitterHistogram::bucketIndex(-1));
+    TEST_ASSERT_EQUAL(kCenter - 1, JitterHistogram::bucketIndex(-kWidth));
+    TEST_ASSERT_EQUAL(kCenter - 2, JitterHistogram::bucketIndex(-kWidth - 1));
+    TEST_ASSERT_EQUAL(0, JitterHistogram::bucketIndex(-100000));
+    TEST_ASSERT_EQUAL(JitterHistogram::kBucketCount - 1, JitterHistogram::bucketIndex(100000));
+}
+
+void test_histogram_tracks_extremes()
+{
+    JitterHistogram histogram;
+    histogram.record(5);
+    histogram.record(-20);
+    histogram.record(300);
+
+    TEST_ASSERT_EQUAL_UINT32(3, histogram.count());
+    TEST_ASSERT_EQUAL_INT32(-20, histogram.minUs());
+    TEST_ASSERT_EQUAL_INT32(300, histogram.maxUs());
+    TEST_ASSERT_EQUAL_UINT32(1, histogram.bucket(JitterHistogram::kBucketCount - 1));
+
+    histogram.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.count());
+    TEST_ASSERT_EQUAL_UINT32(0, histogram.bucket(JitterHistogram::kBucketCount / 2));
+}
+
+void test_stats_measure_row_and_frame_deviation()
+{
+    ScanStats stats;
+
+    // two rows per frame, each scheduled as 400us on + 120us off
+    uint32_t nowUs = 1000;
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        for (int row = 0; row < 2; ++row)
+        {
+            stats.recordStep(nowUs, 400, true, row == 0);
+            nowUs += 400;
+            stats.recordStep(nowUs, 120, false, false);
+            nowUs += 120;
+        }
+        // every frame the second row runs 10us late
+        nowUs += 10;
+    }
+    stats.recordStep(nowUs, 400, true, true);
+
+    const JitterHistogram& rows = stats.rowJitter();
+    TEST_ASSERT_EQUAL_UINT32(6, rows.count());
+    TEST_ASSERT_EQUAL_INT32(0, rows.minUs());
+    TEST_ASSERT_EQUAL_INT32(10, rows.maxUs());
+
+    const JitterHistogram& frames = stats.frameJitter();
+    TEST_ASSERT_EQUAL_UINT32(3, frames.count());
+    TEST_ASSERT_EQUAL_INT32(10, frames.minUs());
+    TEST_ASSERT_EQUAL_UINT32(2 * kRowPeriodUs + 10, stats.lastFramePeriodUs());
+    TEST_ASSERT_EQUAL_UINT32(2 * kRowPeriodUs + 10, stats.maxFramePeriodUs());
+}
+
+void test_stats_survive_timer_wrap()
+{
+    ScanStats stats;
+    stats.recordStep(0xFFFFFF00u, kRowPeriodUs, true, true);
+    stats.recordStep(0xFFFFFF00u + kRowPeriodUs, kRowPeriodUs, true, true);
+
+    TEST_ASSERT_EQUAL_INT32(0, stats.rowJitter().maxUs());
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, stats.lastFramePeriodUs());
+}
+
+void test_stats_count_deadline_misses()
+{
+    ScanStats stats;
+    stats.recordDeadlineMiss();
+    stats.recordDeadlineMiss();
+    TEST_ASSERT_EQUAL_UINT32(2, stats.deadlineMisses());
+
+    stats.requestReset();
+    stats.recordStep(0, kRowPeriodUs, true, true);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.deadlineMisses());
+}
+
+void test_stats_reset_waits_for_frame_start()
+{
+    ScanStats stats;
+    stats.recordStep(0, kRowPeriodUs, true, true);
+    stats.recordStep(kRowPeriodUs + 4, kRowPeriodUs, true, false);
+    stats.recordStep(2 * kRowPeriodUs + 8, kRowPeriodUs, true, true);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.rowJitter().count());
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frameJitter().count());
+
+    // the request alone leaves the counters to the ISR
+    stats.requestReset();
+    TEST_ASSERT_TRUE(stats.isResetPending());
+    stats.recordStep(3 * kRowPeriodUs + 8, kRowPeriodUs, true, false);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.rowJitter().count());
+
+    // cleared at the frame start, which opens a fresh measurement instead of closing the old one
+    stats.recordStep(4 * kRowPeriodUs + 20, kRowPeriodUs, true, true);
+    TEST_ASSERT_FALSE(stats.isResetPending());
+    TEST_ASSERT_EQUAL_UINT32(0, stats.rowJitter().count());
+    TEST_ASSERT_EQUAL_UINT32(0, stats.frameJitter().count());
+    TEST_ASSERT_EQUAL_UINT32(0, stats.lastFramePeriodUs());
+
+    stats.recordStep(5 * kRowPeriodUs + 20, kRowPeriodUs, true, true);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.rowJitter().count());
+    TEST_ASSERT_EQUAL_INT32(0, stats.rowJitter().maxUs());
+    TEST_ASSERT_EQUAL_UINT32(kRowPeriodUs, stats.lastFramePeriodUs());
+}
+
+void test_engine_flags_row_starts()
+{
+    Matrix16x16 matrix;
+    matrix.setAll(true);
+
+    ScanEngine  engine;
+    ScanBuffer& buffer = engine.backBuffer();
+    buffer.build(matrix);
+    buffer.setTiming(kRowPeriodUs, 1, 2);
+    engine.queueFrame();
+
+    // on phase then blank phase for every row
+    for (int row = 0; row < LED_MATRIX_ROWS; ++row)
+    {
+        const ScanEngine::Step on = engine.step();
+        TEST_ASSERT_TRUE(on.rowStart);
+        TEST_ASSERT_EQUAL(row == 0, on.frameStart);
+
+        const ScanEngine::Step off = engine.step();
+        TEST_ASSERT_FALSE(off.rowStart);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_histogram_bucket_index);
+    RUN_TEST(test_histogram_tracks_extremes);
+    RUN_TEST(test_stats_measure_row_and_frame_deviation);
+    RUN_TEST(test_stats_survive_timer_wrap);
+    RUN_TEST(test_stats_count_deadline_misses);
+    RUN_TEST(test_stats_reset_waits_for_frame_start);
+    RUN_TEST(test_engine_flags_row_starts);
+    return UNITY_END();
+}
@@ -41,13 +41,27 @@ void test_shift_register_bitflow()
     backend.reset();
     chain.writeWord(0xA5A5A5A5u);
 
-    TEST_ASSERT_EQUAL(32, backend.bitCount);
+    TEST_ASSERT_EQUAL(SR_CHAIN_CHIPS * 8, backend.bitCount);
     TEST_ASSERT_EQUAL_HEX32(0xA5A5A5A5u, backend.latchedWord);
 }
 
+void test_shift_register_claimed_bus()
+{
+    ShiftRegisterChain claimedChain;
+    claimedChain.begin();
+    claimedChain.claimBus();
+
+    backend.reset();
+    claimedChain.writeWord(0x0FF00FF0u);
+
+    TEST_ASSERT_EQUAL(SR_CHAIN_CHIPS * 8, backend.bitCount);
+    TEST_ASSERT_EQUAL_HEX32(0x0FF00FF0u, backend.latchedWord);
+}
+
 int main(int argc, char** argv)
 {
     UNITY_BEGIN();
     RUN_TEST(test_shift_register_bitflow);
+    RUN_TEST(test_shift_register_claimed_bus);
     return UNITY_END();
 }
@@ -0,0 +1,171 @@
+#include <unity.h>
+#include <config.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "Image.h"
+#include "StateJson.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+namespace
+{
+constexpr int kIterations = 20000;
+
+StateJson::Snapshot typicalSnapshot()
+{
+    StateJson::Snapshot snapshot;
+    snapshot.version = 42;
+    snapshot.mode    = "image";
+    snapshot.layout  = "dual";
+
+    snapshot.top.value              = "Hello \"World\"";
+    snapshot.top.animation          = "scroll";
+    snapshot.top.frameDurationMs    = 60;
+    snapshot.bottom.value           = "line\nbreak";
+    snapshot.bottom.animation       = "ticker";
+    snapshot.bottom.frameDurationMs = 40;
+
+    snapshot.imageCount           = 120;
+    snapshot.imageUnique          = 24;
+    snapshot.imageEncodedBytes    = 618;
+    snapshot.imageFrameDurationMs = 50;
+    snapshot.imageTotalDurationMs = 0;
+    snapshot.imageLoop            = true;
+    snapshot.hasFirstFrame        = true;
+    snapshot.firstFrame.setPixel(0, 0, true);
+    snapshot.firstFrame.setPixel(15, 15, true);
+
+    snapshot.brightnessPercent = 80;
+    snapshot.brightnessDuty    = 0.625f;
+    snapshot.brightnessScale   = 32;
+
+    snapshot.scanSchedule        = "shared";
+    snapshot.rowLoadCompensation = true;
+    return snapshot;
+}
+
+bool contains(const std::string& text, const char* part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+template <typename Fn>
+double nanosecondsPerCall(Fn&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i)
+    {
+        fn(i);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / kIterations;
+}
+
+volatile size_t gSink = 0;
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+}
+
+void tearDown(void)
+{
+}
+
+void test_state_document_fields()
+{
+    std::string json;
+    StateJson::build(typicalSnapshot(), json);
+
+    TEST_ASSERT_EQUAL_CHAR('{', json.front());
+    TEST_ASSERT_EQUAL_CHAR('}', json.back());
+    TEST_ASSERT_TRUE(contains(json, "{\"version\":42,\"mode\":\"image\","));
+    TEST_ASSERT_TRUE(contains(json, "\"top\":{\"value\":\"Hello \\\"World\\\"\",\"animation\":\"scroll\",\"frameDuration\":60}"));
+    TEST_ASSERT_TRUE(contains(json, "\"bottom\":{\"value\":\"line\\nbreak\",\"animation\":\"ticker\",\"frameDuration\":40}"));
+    TEST_ASSERT_TRUE(contains(json, "\"images\":{\"count\":120,\"unique\":24,\"encodedBytes\":618,\"frameDuration\":50,\"totalDuration\":0,\"loop\":true,"));
+    TEST_ASSERT_TRUE(contains(json, "\"firstFrame\":\"8000000000000000000000000000000000000000000000000000000000000001\""));
+    TEST_ASSERT_TRUE(contains(json, "\"brightness\":{\"percent\":80,\"duty\":0.6250,\"scale\":32}"));
+    TEST_ASSERT_TRUE(contains(json, "\"scan\":{\"schedule\":\"shared\",\"rowLoadCompensation\":true}}"));
+
+    StateJson::Snapshot empty = typicalSnapshot();
+    empty.hasFirstFrame = false;
+    StateJson::build(empty, json);
+    TEST_ASSERT_FALSE(contains(json, "firstFrame"));
+}
+
+void test_escapes_control_characters()
+{
+    std::string out;
+    StateJson::appendEscaped(out, std::string("a\\b\t\x01\x1f" "c"));
+    TEST_ASSERT_EQUAL_STRING("a\\\\b\\t\\u0001\\u001fc", out.c_str());
+}
+
+void test_payload_cached_per_version()
+{
+    StateJson cache;
+    TEST_ASSERT_FALSE(cache.isCurrent(0));
+
+    StateJson::Snapshot snapshot = typicalSnapshot();
+    const std::string   first    = cache.update(snapshot);
+    TEST_ASSERT_TRUE(cache.isCurrent(42));
+    TEST_ASSERT_FALSE(cache.isCurrent(43));
+    TEST_ASSERT_EQUAL_UINT32(42, cache.version());
+
+    snapshot.version           = 43;
+    snapshot.brightnessPercent = 10;
+    cache.update(snapshot);
+    TEST_ASSERT_TRUE(cache.isCurrent(43));
+    TEST_ASSERT_TRUE(first != cache.payload());
+    TEST_ASSERT_TRUE(contains(cache.payload(), "\"version\":43"));
+
+    TEST_ASSERT_EQUAL_STRING("\"0000002b\"", StateJson::etag(43).c_str());
+    TEST_ASSERT_EQUAL_STRING("\"ffffffff\"", StateJson::etag(0xFFFFFFFFu).c_str());
+}
+
+void test_benchmark_state_json()
+{
+    const StateJson::Snapshot snapshot = typicalSnapshot();
+
+    // every poll building a fresh document
+    const double freshNs = nanosecondsPerCall([&](int) {
+        std::string json;
+        StateJson::build(snapshot, json);
+        gSink = gSink + json.size();
+    });
+
+    // rebuilding into the cached buffer after a state change
+    std::string reused;
+    const double rebuildNs = nanosecondsPerCall([&](int) {
+        StateJson::build(snapshot, reused);
+        gSink = gSink + reused.size();
+    });
+
+    // a poll without a state change
+    StateJson cache;
+    cache.update(snapshot);
+    volatile uint32_t currentVersion = snapshot.version;
+    const double cachedNs = nanosecondsPerCall([&](int) {
+        if (!cache.isCurrent(currentVersion))
+            cache.update(snapshot);
+        gSink = gSink + cache.payload().size();
+    });
+
+    printf("[bench] state JSON (%u bytes): fresh build %.0f ns, rebuild in place %.0f ns, cached %.1f ns\n",
+           static_cast<unsigned>(reused.size()), freshNs, rebuildNs, cachedNs);
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_state_document_fields);
+    RUN_TEST(test_escapes_control_characters);
+    RUN_TEST(test_payload_cached_per_version);
+    RUN_TEST(test_benchmark_state_json);
+    return UNITY_END();
+}
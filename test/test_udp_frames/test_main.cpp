@@ -0,0 +1,313 @@
+#include <unity.h>
+#include <config.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "Image.h"
+#include "Matrix16x16.h"
+#include "UdpFrameReceiver.h"
+
+MockBackend* gBackend = nullptr;
+MockBackend  backend;
+
+namespace
+{
+using Packet = std::array<uint8_t, UdpFrameReceiver::kMaxPacketBytes>;
+
+// frame `marker` lights pixel (marker % 16, marker / 16 % 16)
+void writeMarkerFrame(int marker, uint8_t* bytes)
+{
+    Image image;
+    image.setPixel(marker % Image::kWidth, (marker / Image::kWidth) % Image::kHeight, true);
+    for (int y = 0; y < Image::kHeight; ++y)
+    {
+        image.getRowBytes(y, bytes + y * Image::kRowBytes);
+    }
+}
+
+// datagram `sequence` carrying frames firstMarker .. firstMarker + count - 1
+size_t markerPacket(uint32_t sequence, uint32_t timestampMs, int firstMarker, size_t count, Packet& packet)
+{
+    std::vector<uint8_t> frames(count * Image::kTotalBytes);
+    for (size_t i = 0; i < count; ++i)
+    {
+        writeMarkerFrame(firstMarker + static_cast<int>(i), frames.data() + i * Image::kTotalBytes);
+    }
+    return UdpFrameReceiver::encode(sequence, timestampMs, frames.data(), count, packet.data(), packet.size());
+}
+
+UdpFrameReceiver::Result receiveMarker(UdpFrameReceiver& receiver, uint32_t sequence, uint32_t nowMs,
+                                       uint32_t timestampMs = 0)
+{
+    Packet       packet{};
+    const size_t length = markerPacket(sequence, timestampMs, static_cast<int>(sequence % 256), 1, packet);
+    return receiver.receive(packet.data(), length, nowMs);
+}
+
+bool shows(const Matrix16x16& matrix, int marker)
+{
+    return matrix.getPixel(marker % Image::kWidth, (marker / Image::kWidth) % Image::kHeight);
+}
+
+uint32_t steadyMs()
+{
+    using namespace std::chrono;
+    return static_cast<uint32_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+}
+
+void tearDown(void)
+{
+}
+
+void test_encode_header_layout()
+{
+    Packet       packet{};
+    const size_t length = markerPacket(0x01020304u, 0xA0B0C0D0u, 0, 2, packet);
+
+    TEST_ASSERT_EQUAL_UINT32(UdpFrameReceiver::kHeaderBytes + 2 * Image::kTotalBytes, length);
+    const uint8_t header[] = {'L', 'F', UdpFrameReceiver::kVersion, 2, 0x01, 0x02, 0x03, 0x04, 0xA0, 0xB0, 0xC0, 0xD0};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(header, packet.data(), sizeof(header));
+
+    // frame 0 lights the top-left pixel: MSB of the first row byte
+    TEST_ASSERT_EQUAL_HEX8(0x80, packet[UdpFrameReceiver::kHeaderBytes]);
+
+    // too many frames or too little room
+    std::vector<uint8_t> frames((UdpFrameReceiver::kMaxFrames + 1) * Image::kTotalBytes);
+    TEST_ASSERT_EQUAL_UINT32(0, UdpFrameReceiver::encode(0, 0, frames.data(), UdpFrameReceiver::kMaxFrames + 1,
+                                                         packet.data(), packet.size()));
+    TEST_ASSERT_EQUAL_UINT32(0, UdpFrameReceiver::encode(0, 0, frames.data(), 0, packet.data(), packet.size()));
+    TEST_ASSERT_EQUAL_UINT32(0, UdpFrameReceiver::encode(0, 0, frames.data(), 1, packet.data(), 20));
+}
+
+void test_rejects_malformed_and_unsupported()
+{
+    UdpFrameReceiver receiver;
+    Packet           packet{};
+    const size_t     length = markerPacket(1, 0, 0, 1, packet);
+
+    TEST_ASSERT_TRUE(receiver.receive(packet.data(), 4, 0) == UdpFrameReceiver::Result::Malformed);
+    TEST_ASSERT_TRUE(receiver.receive(packet.data(), length - 1, 0) == UdpFrameReceiver::Result::Malformed);
+    TEST_ASSERT_TRUE(receiver.receive(packet.data(), length + 1, 0) == UdpFrameReceiver::Result::Malformed);
+
+    Packet badMagic = packet;
+    badMagic[0]     = 'X';
+    TEST_ASSERT_TRUE(receiver.receive(badMagic.data(), length, 0) == UdpFrameReceiver::Result::Malformed);
+
+    Packet noFrames = packet;
+    noFrames[3]     = 0;
+    TEST_ASSERT_TRUE(receiver.receive(noFrames.data(), UdpFrameReceiver::kHeaderBytes, 0) == UdpFrameReceiver::Result::Malformed);
+
+    Packet nextVersion = packet;
+    nextVersion[2]     = UdpFrameReceiver::kVersion + 1;
+    TEST_ASSERT_TRUE(receiver.receive(nextVersion.data(), length, 0) == UdpFrameReceiver::Result::Unsupported);
+
+    TEST_ASSERT_EQUAL_UINT32(5, receiver.malformed());
+    TEST_ASSERT_EQUAL_UINT32(1, receiver.unsupported());
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.packets());
+    TEST_ASSERT_FALSE(receiver.hasFrame());
+}
+
+void test_newest_frame_replaces_pending()
+{
+    UdpFrameReceiver receiver;
+    Matrix16x16      matrix;
+    Packet           packet{};
+
+    const size_t length = markerPacket(1, 0, 10, 3, packet);
+    TEST_ASSERT_TRUE(receiver.receive(packet.data(), length, 0) == UdpFrameReceiver::Result::Started);
+    TEST_ASSERT_EQUAL_UINT32(3, receiver.frames());
+
+    // the next datagram arrives before the display polled: only it is shown
+    TEST_ASSERT_TRUE(receiveMarker(receiver, 2, 1) == UdpFrameReceiver::Result::Accepted);
+    TEST_ASSERT_TRUE(receiver.takeFrame(matrix));
+    TEST_ASSERT_TRUE(shows(matrix, 2));
+    TEST_ASSERT_FALSE(shows(matrix, 12));
+    TEST_ASSERT_FALSE(receiver.takeFrame(matrix));
+    TEST_ASSERT_EQUAL_UINT32(1, receiver.shown());
+}
+
+void test_stale_and_lost_packets()
+{
+    UdpFrameReceiver receiver;
+    Matrix16x16      matrix;
+
+    receiveMarker(receiver, 10, 0);
+    receiver.takeFrame(matrix);
+
+    // duplicate and reordered datagrams are dropped without touching the frame
+    TEST_ASSERT_TRUE(receiveMarker(receiver, 10, 1) == UdpFrameReceiver::Result::Stale);
+    TEST_ASSERT_TRUE(receiveMarker(receiver, 9, 2) == UdpFrameReceiver::Result::Stale);
+    TEST_ASSERT_FALSE(receiver.hasFrame());
+
+    // 11 and 12 never arrive, 12 shows up late
+    TEST_ASSERT_TRUE(receiveMarker(receiver, 13, 3) == UdpFrameReceiver::Result::Accepted);
+    TEST_ASSERT_TRUE(receiveMarker(receiver, 12, 4) == UdpFrameReceiver::Result::Stale);
+    TEST_ASSERT_TRUE(receiver.takeFrame(matrix));
+    TEST_ASSERT_TRUE(shows(matrix, 13));
+
+    TEST_ASSERT_EQUAL_UINT32(2, receiver.lost());
+    TEST_ASSERT_EQUAL_UINT32(3, receiver.stale());
+    TEST_ASSERT_EQUAL_UINT32(2, receiver.packets());
+    TEST_ASSERT_EQUAL_UINT32(13, receiver.lastSequence());
+
+    // sequence numbers wrap
+    UdpFrameReceiver wrapping;
+    receiveMarker(wrapping, 0xFFFFFFFFu, 0);
+    TEST_ASSERT_TRUE(receiveMarker(wrapping, 0, 1) == UdpFrameReceiver::Result::Accepted);
+    TEST_ASSERT_EQUAL_UINT32(0, wrapping.lost());
+}
+
+void test_restarted_sender_starts_new_stream()
+{
+    UdpFrameReceiver receiver;
+
+    receiveMarker(receiver, 5000, 0);
+    TEST_ASSERT_TRUE(receiveMarker(receiver, 1, LIVE_UDP_STREAM_TIMEOUT_MS) == UdpFrameReceiver::Result::Stale);
+
+    // after a pause any sequence number is taken as the start of a new stream
+    TEST_ASSERT_TRUE(receiveMarker(receiver, 1, 2 * LIVE_UDP_STREAM_TIMEOUT_MS + 1) == UdpFrameReceiver::Result::Started);
+    TEST_ASSERT_TRUE(receiveMarker(receiver, 2, 2 * LIVE_UDP_STREAM_TIMEOUT_MS + 2) == UdpFrameReceiver::Result::Accepted);
+    TEST_ASSERT_EQUAL_UINT32(2, receiver.streams());
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.lost());
+}
+
+void test_interarrival_jitter()
+{
+    UdpFrameReceiver receiver;
+
+    // sent every 16 ms, arriving alternately 4 ms early and late
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        const uint32_t arrival = i * 16 + ((i % 2) ? 4 : 0);
+        receiveMarker(receiver, i, arrival, i * 16);
+    }
+    TEST_ASSERT_UINT32_WITHIN(1, 4, receiver.jitterMs());
+
+    receiver.resetStats();
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.jitterMs());
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.packets());
+}
+
+// Real datagrams through a loopback socket: the sender drops every 50th
+// datagram and swaps every 100th pair, the receiver shows the newest frame
+// after each one.
+void test_loopback_socket()
+{
+    const int rx = socket(AF_INET, SOCK_DGRAM, 0);
+    const int tx = socket(AF_INET, SOCK_DGRAM, 0);
+    TEST_ASSERT_TRUE(rx >= 0 && tx >= 0);
+
+    sockaddr_in address{};
+    address.sin_family      = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port        = 0;
+    TEST_ASSERT_EQUAL_INT(0, bind(rx, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+    socklen_t addressLength = sizeof(address);
+    TEST_ASSERT_EQUAL_INT(0, getsockname(rx, reinterpret_cast<sockaddr*>(&address), &addressLength));
+
+    timeval timeout{};
+    timeout.tv_sec = 1;
+    setsockopt(rx, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    constexpr uint32_t kPackets        = 5000;
+    constexpr size_t   kFramesPerPacket = 2;
+
+    UdpFrameReceiver receiver;
+    Matrix16x16      matrix;
+    Packet           packet{};
+    Packet           held{};
+    size_t           heldLength = 0;
+    uint32_t         sent       = 0;
+    uint32_t         shownOk    = 0;
+
+    auto deliver = [&]() {
+        Packet        incoming{};
+        const ssize_t length = recv(rx, incoming.data(), incoming.size(), 0);
+        TEST_ASSERT_TRUE(length > 0);
+
+        const UdpFrameReceiver::Result result = receiver.receive(incoming.data(), static_cast<size_t>(length), steadyMs());
+        if (result == UdpFrameReceiver::Result::Started || result == UdpFrameReceiver::Result::Accepted)
+        {
+            // the newest frame of datagram n is marker 2n + 1
+            TEST_ASSERT_TRUE(receiver.takeFrame(matrix));
+            if (shows(matrix, static_cast<int>((receiver.lastSequence() * kFramesPerPacket + 1) % 256)))
+                ++shownOk;
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t sequence = 0; sequence < kPackets; ++sequence)
+    {
+        const size_t length = markerPacket(sequence, sequence * 16, static_cast<int>((sequence * kFramesPerPacket) % 256),
+                                           kFramesPerPacket, packet);
+        if (sequence % 50 == 25)
+            continue; // lost on the way
+
+        if (sequence % 100 == 10)
+        {
+            held       = packet; // overtaken by the next datagram
+            heldLength = length;
+            continue;
+        }
+
+        sendto(tx, packet.data(), length, 0, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        ++sent;
+        deliver();
+
+        if (heldLength != 0)
+        {
+            sendto(tx, held.data(), heldLength, 0, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+            heldLength = 0;
+            ++sent;
+            deliver();
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    close(tx);
+    close(rx);
+
+    constexpr uint32_t kDropped = kPackets / 50;
+    constexpr uint32_t kSwapped = kPackets / 100;
+    TEST_ASSERT_EQUAL_UINT32(kPackets - kDropped, sent);
+    TEST_ASSERT_EQUAL_UINT32(kPackets - kDropped - kSwapped, receiver.packets());
+    TEST_ASSERT_EQUAL_UINT32(kSwapped, receiver.stale());
+    TEST_ASSERT_EQUAL_UINT32(kDropped + kSwapped, receiver.lost());
+    TEST_ASSERT_EQUAL_UINT32(receiver.packets(), receiver.shown());
+    TEST_ASSERT_EQUAL_UINT32(receiver.shown(), shownOk);
+    TEST_ASSERT_EQUAL_UINT32(1, receiver.streams());
+    TEST_ASSERT_EQUAL_UINT32(0, receiver.malformed());
+
+    printf("[udp] loopback: %u datagrams (%u frames) in %.1f ms, %.0f datagrams/s; lost %u, stale %u\n",
+           static_cast<unsigned>(sent), static_cast<unsigned>(receiver.frames()), seconds * 1000.0,
+           sent / seconds, static_cast<unsigned>(receiver.lost()), static_cast<unsigned>(receiver.stale()));
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_encode_header_layout);
+    RUN_TEST(test_rejects_malformed_and_unsupported);
+    RUN_TEST(test_newest_frame_replaces_pending);
+    RUN_TEST(test_stale_and_lost_packets);
+    RUN_TEST(test_restarted_sender_starts_new_stream);
+    RUN_TEST(test_interarrival_jitter);
+    RUN_TEST(test_loopback_socket);
+    return UNITY_END();
+}
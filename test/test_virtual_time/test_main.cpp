@@ -0,0 +1,191 @@
+#include <unity.h>
+#include <config.h>
+
+#include <cstdint>
+
+#include "GrayscaleMatrix.h"
+#include "Matrix16x16.h"
+#include "ScanBuffer.h"
+#include "ScanEngine.h"
+#include "ShiftRegisterChain.h"
+
+MockBackend*       gBackend = nullptr;
+MockBackend        backend;
+ShiftRegisterChain shiftRegister;
+
+namespace
+{
+constexpr uint32_t kRowPeriodUs = 520;
+constexpr uint64_t kFrameNs     = static_cast<uint64_t>(kRowPeriodUs) * LED_MATRIX_ROWS * 1000u;
+
+// one bit per chain output at the configured SPI clock
+constexpr uint64_t kWordTransferNs = (SR_CHAIN_CHIPS * 8ull * 1000000000ull) / SHIFTREG_SPI_FREQUENCY_HZ;
+
+// run the ISR state machine on the virtual clock: latch, then sleep until the next alarm
+void runEngine(ScanEngine& engine, int frames)
+{
+    int framesStarted = 0;
+    for (;;)
+    {
+        ScanEngine::Step step = engine.step();
+        if (step.frameStart && ++framesStarted > frames)
+            break;
+
+        shiftRegister.writeWord(step.word);
+        backend.delayMicroseconds(step.durationUs);
+    }
+}
+} // namespace
+
+void setUp(void)
+{
+    gBackend = &backend;
+    backend.reset();
+    shiftRegister.begin();
+    backend.resetTiming();
+}
+
+void tearDown(void)
+{
+}
+
+void test_virtual_clock_advances_on_delay()
+{
+    TEST_ASSERT_EQUAL_UINT64(0, backend.micros());
+
+    backend.delayMicroseconds(250);
+    TEST_ASSERT_EQUAL_UINT64(250, backend.micros());
+
+    backend.delayMicroseconds(1);
+    TEST_ASSERT_EQUAL_UINT64(251, backend.micros());
+}
+
+void test_virtual_clock_advances_on_spi_transfer()
+{
+    shiftRegister.writeWord(0x12345678u);
+
+    TEST_ASSERT_EQUAL_UINT64(kWordTransferNs, backend.nowNs);
+    TEST_ASSERT_EQUAL(1, static_cast<int>(backend.latchLog.size()));
+    TEST_ASSERT_EQUAL_UINT64(kWordTransferNs, backend.latchLog[0].timeNs);
+    TEST_ASSERT_EQUAL_HEX32(MockBackend::reverseBits(0x12345678u), backend.latchLog[0].word);
+}
+
+void test_virtual_luminance_follows_latched_word()
+{
+    Matrix16x16 matrix;
+    matrix.setPixel(3, 5, true);
+
+    shiftRegister.writeWord(matrix.composeRowWord(5));
+
+    backend.delayMicroseconds(100);
+    shiftRegister.writeWord(ScanBuffer::kBlankWord);
+    backend.delayMicroseconds(100);
+
+    // lit from the first latch until the blank word was latched
+    TEST_ASSERT_EQUAL_UINT64(100000u + kWordTransferNs, backend.ledOnTimeNs(3, 5));
+    TEST_ASSERT_EQUAL_UINT64(0, backend.ledOnTimeNs(3, 4));
+    TEST_ASSERT_EQUAL_UINT64(0, backend.ledOnTimeNs(4, 5));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.5f, backend.luminance(3, 5));
+}
+
+void test_virtual_output_enable_blanks_leds()
+{
+    Matrix16x16 matrix;
+    matrix.setPixel(0, 0, true);
+    shiftRegister.writeWord(matrix.composeRowWord(0));
+
+    const uint64_t before = backend.ledOnTimeNs(0, 0);
+    shiftRegister.enableOutput(false);
+    backend.delayMicroseconds(500);
+    TEST_ASSERT_EQUAL_UINT64(before, backend.ledOnTimeNs(0, 0));
+
+    shiftRegister.enableOutput(true);
+    backend.delayMicroseconds(500);
+    TEST_ASSERT_EQUAL_UINT64(before + 500000u, backend.ledOnTimeNs(0, 0));
+}
+
+void test_virtual_engine_row_brightness()
+{
+    Matrix16x16 matrix;
+    matrix.setAll(true);
+
+    ScanEngine  engine;
+    ScanBuffer& buffer = engine.backBuffer();
+    buffer.build(matrix);
+    buffer.setTiming(kRowPeriodUs, 8, 32);
+    engine.queueFrame();
+
+    runEngine(engine, 1);
+
+    // every row adds two word transfers to the nominal period
+    TEST_ASSERT_EQUAL_UINT64(kFrameNs + LED_MATRIX_ROWS * 2 * kWordTransferNs, backend.nowNs);
+
+    // each LED is lit for its quarter of the row period plus the transfer of the blank word
+    const uint64_t expectedNs = (kRowPeriodUs / 4) * 1000u + kWordTransferNs;
+    for (int y = 0; y < LED_MATRIX_ROWS; ++y)
+    {
+        for (int x = 0; x < LED_MATRIX_COLS; ++x)
+        {
+            TEST_ASSERT_EQUAL_UINT64(expectedNs, backend.ledOnTimeNs(x, y));
+        }
+    }
+}
+
+void test_virtual_engine_refresh_rate_and_luminance()
+{
+    GrayscaleMatrix matrix(4);
+    matrix.setPixel(0, 0, 15);
+    matrix.setPixel(1, 0, 1);
+    matrix.setPixel(2, 0, 0);
+
+    ScanEngine  engine;
+    ScanBuffer& buffer = engine.backBuffer();
+    buffer.build(matrix);
+    buffer.setTiming(kRowPeriodUs, 1, 1);
+    engine.queueFrame();
+
+    constexpr int kFrames = 4;
+    runEngine(engine, kFrames);
+
+    // frame period measured from the latch log: first latch of row 0 in consecutive frames
+    const MockBackend::Word rowZeroWord = MockBackend::reverseBits(buffer.planeWord(0, 0));
+    uint64_t                firstNs     = 0;
+    uint64_t                lastNs      = 0;
+    int                     rowZeroHits = 0;
+    for (const MockBackend::LatchEvent& event : backend.latchLog)
+    {
+        if (event.word != rowZeroWord)
+            continue;
+        if (rowZeroHits == 0)
+            firstNs = event.timeNs;
+        lastNs = event.timeNs;
+        ++rowZeroHits;
+    }
+
+    TEST_ASSERT_EQUAL(kFrames, rowZeroHits);
+    // at full brightness the four planes fill the row, so there is no blank phase
+    TEST_ASSERT_EQUAL_UINT32(0, buffer.rowOffTimeUs(0));
+    const uint64_t stepsPerFrame = LED_MATRIX_ROWS * 4;
+    TEST_ASSERT_EQUAL_UINT64(kFrameNs + stepsPerFrame * kWordTransferNs, (lastNs - firstNs) / (kFrames - 1));
+
+    // BCM: level 15 is lit during all four planes, level 1 only during plane 0;
+    // each plane stays on the outputs while the following word is shifted in
+    const uint64_t lsbNs = static_cast<uint64_t>(buffer.planeOnTimeUs(0, 0)) * 1000u;
+    TEST_ASSERT_EQUAL_UINT64((kRowPeriodUs + 7u) / 15u * 1000u, lsbNs);
+    TEST_ASSERT_EQUAL_UINT64(kFrames * (kRowPeriodUs * 1000u + 4 * kWordTransferNs), backend.ledOnTimeNs(0, 0));
+    TEST_ASSERT_EQUAL_UINT64(kFrames * (lsbNs + kWordTransferNs),                   backend.ledOnTimeNs(1, 0));
+    TEST_ASSERT_EQUAL_UINT64(0, backend.ledOnTimeNs(2, 0));
+    TEST_ASSERT_EQUAL_UINT64(0, backend.ledOnTimeNs(0, 1));
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_virtual_clock_advances_on_delay);
+    RUN_TEST(test_virtual_clock_advances_on_spi_transfer);
+    RUN_TEST(test_virtual_luminance_follows_latched_word);
+    RUN_TEST(test_virtual_output_enable_blanks_leds);
+    RUN_TEST(test_virtual_engine_row_brightness);
+    RUN_TEST(test_virtual_engine_refresh_rate_and_luminance);
+    return UNITY_END();
+}
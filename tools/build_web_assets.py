@@ -0,0 +1,81 @@
+"""Minify and gzip web/index.html into the flash array in src/WebAssets.h.
+
+Runs before every firmware build as a PlatformIO extra script (see
+platformio.ini) and can be run by hand:
+
+    python3 tools/build_web_assets.py
+
+The header is only rewritten when its content changes, so an untouched page
+does not trigger a recompile. The output is deterministic (no gzip timestamp),
+and the ETag is derived from the compressed bytes.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+SOURCE = os.path.join("web", "index.html")
+OUTPUT = os.path.join("src", "WebAssets.h")
+BYTES_PER_LINE = 16
+
+
+def project_dir():
+    try:
+        Import("env")  # noqa: F821 - provided by PlatformIO
+        return env["PROJECT_DIR"]  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def minify(html):
+    # conservative: drop comments, indentation and blank lines, keep line
+    # breaks so statements in the inline script stay separated
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    lines = (line.strip() for line in html.splitlines())
+    return "\n".join(line for line in lines if line)
+
+
+def render_header(raw_size, data):
+    etag = '"' + hashlib.sha256(data).hexdigest()[:16] + '"'
+    rows = []
+    for start in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[start:start + BYTES_PER_LINE]
+        rows.append("    " + ", ".join("0x%02x" % b for b in chunk) + ",")
+
+    return "\n".join([
+        "// Generated by tools/build_web_assets.py from web/index.html - do not edit.",
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "// minified web UI, %d bytes before compression" % raw_size,
+        "constexpr size_t INDEX_HTML_GZ_LENGTH = %d;" % len(data),
+        "constexpr char   INDEX_HTML_ETAG[]    = \"%s\";" % etag.replace('"', '\\"'),
+        "",
+        "const uint8_t INDEX_HTML_GZ[] PROGMEM = {",
+    ] + rows + [
+        "};",
+        "",
+    ])
+
+
+def build(root):
+    with open(os.path.join(root, SOURCE), encoding="utf-8") as source:
+        page = minify(source.read()).encode("utf-8")
+
+    data = gzip.compress(page, compresslevel=9, mtime=0)
+    header = render_header(len(page), data)
+
+    output = os.path.join(root, OUTPUT)
+    if os.path.exists(output):
+        with open(output, encoding="utf-8") as current:
+            if current.read() == header:
+                return
+
+    with open(output, "w", encoding="utf-8", newline="\n") as target:
+        target.write(header)
+    print("web assets: %s -> %s (%d -> %d bytes)" % (SOURCE, OUTPUT, len(page), len(data)))
+
+
+build(project_dir())
@@ -0,0 +1,147 @@
+"""Stream live frames to the panel over UDP and report throughput and loss.
+
+Sends datagrams in the format decoded by src/UdpFrameReceiver.h at a fixed
+rate, then reads the device counters from /api/stats/live to see how many
+arrived:
+
+    python3 tools/udp_sender.py 192.168.1.50 --fps 60 --seconds 10
+    python3 tools/udp_sender.py 192.168.1.50 --fps 0 --frames-per-packet 4
+
+--fps 0 sends as fast as the socket allows (a throughput test). With
+--frames-per-packet n every datagram also repeats the n - 1 frames before the
+newest one, as the protocol allows. --no-stats skips the HTTP requests, e.g.
+for a device without the web interface reachable.
+"""
+
+import argparse
+import json
+import os
+import socket
+import struct
+import sys
+import time
+import urllib.request
+
+MAGIC = b"LF"
+VERSION = 1
+HEADER = struct.Struct(">2sBBII")  # magic, version, frame count, sequence, timestamp ms
+WIDTH = 16
+HEIGHT = 16
+FRAME_BYTES = WIDTH * HEIGHT // 8
+MAX_FRAMES_PER_PACKET = 16  # LIVE_UDP_MAX_FRAMES_PER_PACKET
+
+
+def frame_bytes(rows):
+    # rows are WIDTH-bit integers, x = 0 in the most significant bit
+    return b"".join(row.to_bytes(WIDTH // 8, "big") for row in rows)
+
+
+def pattern_scan(index):
+    column = index % WIDTH
+    return frame_bytes([1 << (WIDTH - 1 - column)] * HEIGHT)
+
+
+def pattern_counter(index):
+    # frame number in binary on the top row, handy to spot skipped frames
+    return frame_bytes([index & 0xFFFF] + [0] * (HEIGHT - 1))
+
+
+def pattern_noise(index):
+    return os.urandom(FRAME_BYTES)
+
+
+PATTERNS = {
+    "scan": pattern_scan,
+    "counter": pattern_counter,
+    "noise": pattern_noise,
+}
+
+
+def encode(sequence, timestamp_ms, frames):
+    header = HEADER.pack(MAGIC, VERSION, len(frames), sequence & 0xFFFFFFFF, timestamp_ms & 0xFFFFFFFF)
+    return header + b"".join(frames)
+
+
+def fetch_stats(host, http_port, reset=False):
+    url = "http://%s:%d/api/stats/live%s" % (host, http_port, "?reset=1" if reset else "")
+    with urllib.request.urlopen(url, timeout=2) as response:
+        return json.load(response)
+
+
+def stream(sock, address, pattern, fps, seconds, frames_per_packet):
+    interval = 1.0 / fps if fps > 0 else 0.0
+    history = []
+    sent = 0
+    sent_bytes = 0
+    late = 0
+
+    start = time.perf_counter()
+    deadline = start
+    while True:
+        now = time.perf_counter()
+        if now - start >= seconds:
+            break
+
+        if interval > 0.0:
+            # absolute deadlines, so a late datagram does not shift the rest
+            if now < deadline:
+                time.sleep(deadline - now)
+            elif now - deadline > interval:
+                late += 1
+            deadline += interval
+
+        history.append(pattern(sent))
+        history = history[-frames_per_packet:]
+        timestamp_ms = int((time.perf_counter() - start) * 1000)
+        datagram = encode(sent, timestamp_ms, history)
+        sock.sendto(datagram, address)
+        sent += 1
+        sent_bytes += len(datagram)
+
+    return sent, sent_bytes, late, time.perf_counter() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="device address")
+    parser.add_argument("--port", type=int, default=7777, help="UDP port (LIVE_UDP_PORT)")
+    parser.add_argument("--http-port", type=int, default=80, help="web interface port for the counters")
+    parser.add_argument("--fps", type=float, default=60.0, help="datagrams per second, 0 = as fast as possible")
+    parser.add_argument("--seconds", type=float, default=10.0, help="length of the run")
+    parser.add_argument("--frames-per-packet", type=int, default=1,
+                        help="frames per datagram, newest last (1..%d)" % MAX_FRAMES_PER_PACKET)
+    parser.add_argument("--pattern", choices=sorted(PATTERNS), default="scan")
+    parser.add_argument("--no-stats", action="store_true", help="do not read the device counters")
+    args = parser.parse_args()
+
+    if not 1 <= args.frames_per_packet <= MAX_FRAMES_PER_PACKET:
+        parser.error("--frames-per-packet must be 1..%d" % MAX_FRAMES_PER_PACKET)
+
+    if not args.no_stats:
+        fetch_stats(args.host, args.http_port, reset=True)
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sent, sent_bytes, late, elapsed = stream(sock, (args.host, args.port), PATTERNS[args.pattern],
+                                             args.fps, args.seconds, args.frames_per_packet)
+    sock.close()
+
+    print("sent %d datagrams (%d bytes each) in %.2f s: %.0f datagrams/s, %.1f kbit/s, %d sent late"
+          % (sent, HEADER.size + args.frames_per_packet * FRAME_BYTES, elapsed,
+             sent / elapsed, sent_bytes * 8 / elapsed / 1000, late))
+
+    if args.no_stats:
+        return 0
+
+    # give the device a moment to drain its socket
+    time.sleep(0.2)
+    udp = fetch_stats(args.host, args.http_port)["udp"]
+    missing = max(sent - udp["packets"] - udp["stale"], 0)
+    print("device accepted %d, stale %d, lost %d (gaps), missing %d (%.2f%% loss), "
+          "shown %d frames, jitter %d ms, malformed %d, unsupported %d"
+          % (udp["packets"], udp["stale"], udp["lost"], missing, 100.0 * missing / max(sent, 1),
+             udp["shown"], udp["jitterMs"], udp["malformed"], udp["unsupported"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())